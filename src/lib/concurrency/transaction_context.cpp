@@ -0,0 +1,61 @@
+#include "transaction_context.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "storage/mvcc_data.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id(transaction_id), _snapshot_commit_id(snapshot_commit_id) {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase == TransactionPhase::Active) rollback();
+}
+
+TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
+
+CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+
+TransactionPhase TransactionContext::phase() const { return _phase; }
+
+bool TransactionContext::is_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const {
+  return mvcc_data.is_visible(chunk_offset, _transaction_id, _snapshot_commit_id);
+}
+
+void TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "TransactionContext: only active transactions can be committed");
+  TransactionManager::get()._commit([&](const CommitID commit_id) {
+    // The inserted rows are unlocked, so that other transactions can delete them. The deleted rows stay locked, so that
+    // no other transaction deletes them again.
+    for (const auto& [mvcc_data, chunk_offset] : _inserts) {
+      mvcc_data->begin_cids[chunk_offset] = commit_id;
+      mvcc_data->tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    }
+    for (const auto& [mvcc_data, chunk_offset] : _deletes) mvcc_data->end_cids[chunk_offset] = commit_id;
+  });
+  _phase = TransactionPhase::Committed;
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active, "TransactionContext: only active transactions can be rolled back");
+  // the inserted rows keep their begin commit id, so that they are visible to no transaction
+  for (const auto& [mvcc_data, chunk_offset] : _inserts) mvcc_data->tids[chunk_offset] = INVALID_TRANSACTION_ID;
+  for (const auto& [mvcc_data, chunk_offset] : _deletes) mvcc_data->tids[chunk_offset] = INVALID_TRANSACTION_ID;
+  _phase = TransactionPhase::RolledBack;
+}
+
+void TransactionContext::register_insert(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset) {
+  DebugAssert(_phase == TransactionPhase::Active, "TransactionContext: transaction is not active");
+  _inserts.emplace_back(std::move(mvcc_data), chunk_offset);
+}
+
+void TransactionContext::register_delete(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset) {
+  DebugAssert(_phase == TransactionPhase::Active, "TransactionContext: transaction is not active");
+  _deletes.emplace_back(std::move(mvcc_data), chunk_offset);
+}
+
+}  // namespace opossum
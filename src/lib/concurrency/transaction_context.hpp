@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct MvccData;
+
+enum class TransactionPhase { Active, Committed, RolledBack };
+
+// A TransactionContext represents a running transaction, see TransactionManager::new_transaction_context. It reads the
+// snapshot it was started with and records the rows it inserts and deletes (see Table), which become visible to other
+// transactions once it commits. A transaction that is destroyed while it is active is rolled back.
+class TransactionContext : private Noncopyable {
+ public:
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+  CommitID snapshot_commit_id() const;
+  TransactionPhase phase() const;
+
+  // returns whether the row is visible to this transaction
+  bool is_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const;
+
+  // makes the inserts and deletes of the transaction visible to transactions started afterwards
+  void commit();
+
+  // discards the inserts and deletes of the transaction
+  void rollback();
+
+  // record a row that was inserted or deleted by this transaction, which holds the row lock
+  void register_insert(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset);
+  void register_delete(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset);
+
+ protected:
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  TransactionPhase _phase = TransactionPhase::Active;
+
+  std::vector<std::pair<std::shared_ptr<MvccData>, ChunkOffset>> _inserts;
+  std::vector<std::pair<std::shared_ptr<MvccData>, ChunkOffset>> _deletes;
+};
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#include "transaction_manager.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "transaction_context.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static auto transaction_manager = TransactionManager{};
+  return transaction_manager;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id.load());
+}
+
+CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
+
+void TransactionManager::_commit(const std::function<void(CommitID)>& apply) {
+  const auto lock = std::lock_guard{_commit_mutex};
+  const auto commit_id = _last_commit_id + 1;
+  apply(commit_id);
+  _last_commit_id = commit_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that starts transactions and orders their commits. A new transaction reads
+// the snapshot of the last commit, i.e., it sees all rows committed up to then and none committed later.
+class TransactionManager : private Noncopyable {
+ public:
+  static TransactionManager& get();
+
+  // starts a transaction
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // returns the commit id of the last commit, i.e., the snapshot of new transactions
+  CommitID last_commit_id() const;
+
+  TransactionManager(TransactionManager&&) = delete;
+
+ protected:
+  friend class TransactionContext;
+
+  TransactionManager() {}
+
+  // Calls apply with the next commit id, e.g., to set the commit ids of the inserted and deleted rows, and publishes
+  // the commit afterwards. Commits are applied one at a time, so that a snapshot never includes a partial commit.
+  void _commit(const std::function<void(CommitID)>& apply);
+
+  std::atomic<TransactionID> _next_transaction_id{INVALID_TRANSACTION_ID + 1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+};
+
+}  // namespace opossum
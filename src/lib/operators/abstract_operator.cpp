@@ -2,9 +2,13 @@
 
 #include <chrono>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
@@ -14,7 +18,11 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
                                    const std::shared_ptr<const AbstractOperator> right)
     : _left_input(left), _right_input(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  _arena = std::make_shared<std::pmr::monotonic_buffer_resource>();
+  _output = _on_execute();
+  _arena = nullptr;
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -26,4 +34,22 @@ std::shared_ptr<const Table> AbstractOperator::_left_input_table() const { retur
 
 std::shared_ptr<const Table> AbstractOperator::_right_input_table() const { return _right_input->get_output(); }
 
+void AbstractOperator::set_transaction_context(std::shared_ptr<TransactionContext> transaction_context) {
+  _transaction_context = std::move(transaction_context);
+}
+
+std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const { return _transaction_context; }
+
+std::shared_ptr<PosList> AbstractOperator::_make_pos_list() {
+  DebugAssert(_arena, "AbstractOperator::_make_pos_list: operator is not being executed");
+  // The deleter keeps the arena alive. The control block is allocated from the default heap, as it is released after
+  // the deleter, which may have destroyed the arena by then.
+  auto* memory = _arena->allocate(sizeof(PosList), alignof(PosList));
+  auto* pos_list = new (memory) PosList(_arena.get());
+  return std::shared_ptr<PosList>(pos_list, [arena = _arena](PosList* list) {
+    list->~PosList();
+    arena->deallocate(list, sizeof(PosList), alignof(PosList));
+  });
+}
+
 }  // namespace opossum
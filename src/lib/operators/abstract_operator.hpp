@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,7 @@
 namespace opossum {
 
 class Table;
+class TransactionContext;
 
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
@@ -21,6 +23,13 @@ class Table;
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
 // Operators shall not be executed twice.
+//
+// Intermediate results, e.g., the PosLists of ReferenceSegments, are allocated from a monotonic arena that is created
+// for each execution. It hands out memory without synchronization and frees it all at once, when the operator and all
+// results allocated from it are gone.
+//
+// Operators that are executed within a transaction only see the rows that are visible to it. Without a transaction
+// context, they see all rows of the tables.
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -43,6 +52,10 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  // sets the transaction the operator is executed in, has to be called before execute
+  void set_transaction_context(std::shared_ptr<TransactionContext> transaction_context);
+  std::shared_ptr<TransactionContext> transaction_context() const;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -52,12 +65,21 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _left_input_table() const;
   std::shared_ptr<const Table> _right_input_table() const;
 
+  // returns an empty PosList allocated from the arena of the current execution, can only be called from _on_execute
+  std::shared_ptr<PosList> _make_pos_list();
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _left_input;
   std::shared_ptr<const AbstractOperator> _right_input;
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  // Is nullptr if the operator is not executed within a transaction
+  std::shared_ptr<TransactionContext> _transaction_context;
+
+  // Is nullptr outside of execute. PosLists allocated from it share its ownership.
+  std::shared_ptr<std::pmr::monotonic_buffer_resource> _arena;
 };
 
 }  // namespace opossum
@@ -0,0 +1,454 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterables/reference_segment_iterable.hpp"
+#include "storage/segment_iterables/value_segment_iterable.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls functor with the comparator object (e.g., std::less<>) matching scan_type. This way, the comparison is resolved
+// at compile time and can be inlined into the scan loops.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+  }
+  Fail("Unknown ScanType");
+}
+
+// A predicate on values translated into a predicate on unsigned integers, i.e., value ids of a dictionary or offsets
+// of a frame of reference block. Often, the translation already shows that all or no rows match.
+struct TranslatedPredicate {
+  enum class Result { MatchesAll, MatchesNone, Compare };
+
+  Result result;
+  ScanType scan_type = ScanType::OpEquals;
+  uint32_t search_value = 0;
+};
+
+constexpr auto MATCHES_ALL = TranslatedPredicate{TranslatedPredicate::Result::MatchesAll};
+constexpr auto MATCHES_NONE = TranslatedPredicate{TranslatedPredicate::Result::MatchesNone};
+
+// Translates a predicate on the values of a dictionary into one on its value ids
+template <typename T, typename Dictionary>
+TranslatedPredicate translate_to_value_ids(const DictionarySegment<T, Dictionary>& segment, const ScanType scan_type,
+                                           const T& search_value) {
+  const auto compare = [](const ScanType translated_scan_type, const ValueID value_id) {
+    return TranslatedPredicate{TranslatedPredicate::Result::Compare, translated_scan_type, value_id};
+  };
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals: {
+      const auto value_id = segment.lower_bound(search_value);
+      const auto found = value_id != INVALID_VALUE_ID && segment.value_by_value_id(value_id) == search_value;
+      if (!found) return scan_type == ScanType::OpEquals ? MATCHES_NONE : MATCHES_ALL;
+      return compare(scan_type, value_id);
+    }
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals: {
+      // all values below the first value id that does not match
+      const auto bound = scan_type == ScanType::OpLessThan ? segment.lower_bound(search_value)
+                                                           : segment.upper_bound(search_value);
+      if (bound == INVALID_VALUE_ID) return MATCHES_ALL;
+      if (bound == ValueID{0}) return MATCHES_NONE;
+      return compare(ScanType::OpLessThan, bound);
+    }
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals: {
+      // all values starting with the first value id that matches
+      const auto bound = scan_type == ScanType::OpGreaterThan ? segment.upper_bound(search_value)
+                                                              : segment.lower_bound(search_value);
+      if (bound == INVALID_VALUE_ID) return MATCHES_NONE;
+      if (bound == ValueID{0}) return MATCHES_ALL;
+      return compare(ScanType::OpGreaterThanEquals, bound);
+    }
+  }
+  Fail("Unknown ScanType");
+}
+
+// Translates a predicate on the values of a frame of reference block into one on the offsets to the block's minimum
+template <typename T>
+TranslatedPredicate translate_to_offsets(const T block_minimum, const ScanType scan_type, const T& search_value) {
+  const auto search_value_is_smaller = search_value < block_minimum;
+  // the difference is computed in unsigned arithmetic, as it may overflow T
+  const auto offset = static_cast<uint64_t>(search_value) - static_cast<uint64_t>(block_minimum);
+  const auto search_value_is_larger = !search_value_is_smaller && offset > std::numeric_limits<uint32_t>::max();
+
+  if (search_value_is_smaller || search_value_is_larger) {
+    // the search value lies outside of the range of the block
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return MATCHES_NONE;
+      case ScanType::OpNotEquals:
+        return MATCHES_ALL;
+      case ScanType::OpLessThan:
+      case ScanType::OpLessThanEquals:
+        return search_value_is_smaller ? MATCHES_NONE : MATCHES_ALL;
+      case ScanType::OpGreaterThan:
+      case ScanType::OpGreaterThanEquals:
+        return search_value_is_smaller ? MATCHES_ALL : MATCHES_NONE;
+    }
+  }
+  return TranslatedPredicate{TranslatedPredicate::Result::Compare, scan_type, static_cast<uint32_t>(offset)};
+}
+
+// Evaluates a translated predicate for the positions [begin, end) of an attribute vector, which is decoded in batches
+void scan_attribute_vector(const BaseAttributeVector& attribute_vector, const size_t begin, const size_t end,
+                           const TranslatedPredicate& predicate, std::vector<ChunkOffset>& matches) {
+  if (predicate.result == TranslatedPredicate::Result::MatchesNone) return;
+  if (predicate.result == TranslatedPredicate::Result::MatchesAll) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      matches.push_back(static_cast<ChunkOffset>(chunk_offset));
+    }
+    return;
+  }
+
+  // a multiple of the block size of SimdBp128AttributeVector, so that its blocks can be decoded in place
+  constexpr auto BATCH_SIZE = size_t{1024};
+  auto batch = std::array<ValueID, BATCH_SIZE>{};
+  with_comparator(predicate.scan_type, [&](auto comparator) {
+    for (auto batch_begin = begin; batch_begin < end; batch_begin += BATCH_SIZE) {
+      const auto batch_end = std::min(batch_begin + BATCH_SIZE, end);
+      attribute_vector.decode_into(batch.data(), batch_begin, batch_end);
+      for (auto i = size_t{0}; i < batch_end - batch_begin; ++i) {
+        if (comparator(static_cast<uint32_t>(batch[i]), predicate.search_value)) {
+          matches.push_back(static_cast<ChunkOffset>(batch_begin + i));
+        }
+      }
+    }
+  });
+}
+
+// Collects the matching offsets from an index on the scanned column. As the index positions are sorted by value,
+// the matches form one or two ranges of positions. They are sorted afterwards to keep the order of the rows.
+void scan_index(const BaseIndex& index, const ScanType scan_type, const AllTypeVariant& search_value,
+                std::vector<ChunkOffset>& matches) {
+  const auto append_range = [&](const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    matches.insert(matches.end(), begin, end);
+  };
+
+  switch (scan_type) {
+    case ScanType::OpEquals: {
+      const auto [begin, end] = index.equals({search_value});
+      append_range(begin, end);
+      break;
+    }
+    case ScanType::OpNotEquals:
+      append_range(index.cbegin(), index.lower_bound({search_value}));
+      append_range(index.upper_bound({search_value}), index.cend());
+      break;
+    case ScanType::OpLessThan:
+      append_range(index.cbegin(), index.lower_bound({search_value}));
+      break;
+    case ScanType::OpLessThanEquals:
+      append_range(index.cbegin(), index.upper_bound({search_value}));
+      break;
+    case ScanType::OpGreaterThan:
+      append_range(index.upper_bound({search_value}), index.cend());
+      break;
+    case ScanType::OpGreaterThanEquals:
+      append_range(index.lower_bound({search_value}), index.cend());
+      break;
+  }
+  std::sort(matches.begin(), matches.end());
+}
+
+}  // namespace
+
+// Type-erased interface of TableScanImpl, which holds the typed search value and the scan kernels
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // Appends the offsets of all rows of the segment that match the predicate to matches. Only the first size rows are
+  // scanned, as further rows might be appended to ValueSegments concurrently.
+  virtual void scan_segment(const BaseSegment& segment, const ChunkOffset size,
+                            std::vector<ChunkOffset>& matches) const = 0;
+
+  // returns true if the statistics show that no row of the segment can match the predicate
+  virtual bool can_prune(const SegmentStatistics& statistics) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value)
+      : _scan_type(scan_type), _search_value(type_cast<T>(search_value)) {}
+
+  void scan_segment(const BaseSegment& segment, const ChunkOffset size,
+                    std::vector<ChunkOffset>& matches) const final {
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+      _scan_iterable(ValueSegmentIterable<T>{*value_segment, size}, matches);
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      _scan_dictionary_segment(*dictionary_segment, matches);
+    } else if (_scan_front_coded_dictionary_segment(segment, matches)) {
+      return;
+    } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+      _scan_run_length_segment(*run_length_segment, matches);
+    } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+      _scan_iterable(ReferenceSegmentIterable<T>{*reference_segment}, matches);
+    } else if (!_scan_frame_of_reference_segment(segment, matches)) {
+      Fail("TableScan: unsupported segment type");
+    }
+  }
+
+  bool can_prune(const SegmentStatistics& statistics) const final {
+    const auto& min = get<T>(statistics.min);
+    const auto& max = get<T>(statistics.max);
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return _search_value < min || max < _search_value ||
+               (statistics.bloom_filter && !statistics.bloom_filter->may_contain(mixed_hash(_search_value)));
+      case ScanType::OpNotEquals:
+        return min == _search_value && max == _search_value;
+      case ScanType::OpLessThan:
+        return !(min < _search_value);
+      case ScanType::OpLessThanEquals:
+        return _search_value < min;
+      case ScanType::OpGreaterThan:
+        return !(_search_value < max);
+      case ScanType::OpGreaterThanEquals:
+        return max < _search_value;
+    }
+    Fail("Unknown ScanType");
+  }
+
+ protected:
+  // FrontCodedDictionarySegments only exist for strings. Returns false if the segment is none.
+  bool _scan_front_coded_dictionary_segment(const BaseSegment& segment, std::vector<ChunkOffset>& matches) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (const auto front_coded_segment = dynamic_cast<const FrontCodedDictionarySegment*>(&segment)) {
+        _scan_dictionary_segment(*front_coded_segment, matches);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // compares the value ids instead of the values, decoding them in batches
+  template <typename Segment>
+  void _scan_dictionary_segment(const Segment& segment, std::vector<ChunkOffset>& matches) const {
+    const auto predicate = translate_to_value_ids(segment, _scan_type, _search_value);
+    scan_attribute_vector(*segment.attribute_vector(), 0, segment.size(), predicate, matches);
+  }
+
+  // Appends the chunk offsets of the matching positions of the iterable to matches. For ReferenceSegments, these are
+  // the indices into the PosList. Ranges of dictionary-encoded values are scanned by their value ids.
+  template <typename Iterable>
+  void _scan_iterable(const Iterable& iterable, std::vector<ChunkOffset>& matches) const {
+    iterable.with_iterators([&](auto it, const auto end) {
+      if constexpr (has_value_ids_v<decltype(it)>) {
+        _scan_value_ids(it, end, matches);
+      } else {
+        with_comparator(_scan_type, [&](auto comparator) {
+          for (; it != end; ++it) {
+            const auto position = *it;
+            if (comparator(position.value(), _search_value)) matches.push_back(position.chunk_offset());
+          }
+        });
+      }
+    });
+  }
+
+  // compares the value ids of the positions instead of their values, e.g., for ranges of a ReferenceSegment
+  template <typename Iterator>
+  void _scan_value_ids(Iterator it, const Iterator end, std::vector<ChunkOffset>& matches) const {
+    if (it == end) return;
+    const auto predicate = translate_to_value_ids(it.dictionary_segment(), _scan_type, _search_value);
+    if (predicate.result == TranslatedPredicate::Result::MatchesNone) return;
+    if (predicate.result == TranslatedPredicate::Result::MatchesAll) {
+      for (; it != end; ++it) matches.push_back(it.chunk_offset());
+      return;
+    }
+
+    with_comparator(predicate.scan_type, [&](auto comparator) {
+      for (; it != end; ++it) {
+        if (comparator(static_cast<uint32_t>(it.value_id()), predicate.search_value)) {
+          matches.push_back(it.chunk_offset());
+        }
+      }
+    });
+  }
+
+  // evaluates the predicate once per run
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, std::vector<ChunkOffset>& matches) const {
+    const auto& values = *segment.values();
+    const auto& end_positions = *segment.end_positions();
+    with_comparator(_scan_type, [&](auto comparator) {
+      auto run_begin = ChunkOffset{0};
+      for (auto run = size_t{0}; run < values.size(); ++run) {
+        if (comparator(values[run], _search_value)) {
+          for (auto chunk_offset = run_begin; chunk_offset <= end_positions[run]; ++chunk_offset) {
+            matches.push_back(chunk_offset);
+          }
+        }
+        run_begin = end_positions[run] + 1;
+      }
+    });
+  }
+
+  // rewrites the predicate per block into the space of the offsets and compares them without decoding the values
+  bool _scan_frame_of_reference_segment(const BaseSegment& base_segment, std::vector<ChunkOffset>& matches) const {
+    if constexpr (std::is_integral_v<T>) {
+      const auto segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&base_segment);
+      if (!segment) return false;
+
+      const auto& block_minima = *segment->block_minima();
+      const auto& offsets = *segment->offsets();
+      constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      for (auto block = size_t{0}; block < block_minima.size(); ++block) {
+        const auto predicate = translate_to_offsets(block_minima[block], _scan_type, _search_value);
+        const auto block_begin = block * BLOCK_SIZE;
+        scan_attribute_vector(offsets, block_begin, std::min(block_begin + BLOCK_SIZE, size_t{segment->size()}),
+                              predicate, matches);
+      }
+      return true;
+    }
+    return false;
+  }
+
+  const ScanType _scan_type;
+  const T _search_value;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(_column_id < input_table->column_count(), "TableScan: column_id out of range");
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  auto impl = std::unique_ptr<BaseTableScanImpl>{};
+  resolve_data_type(input_table->column_type(_column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    impl = std::make_unique<TableScanImpl<Type>>(_scan_type, _search_value);
+  });
+
+  auto matches = std::vector<ChunkOffset>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    // rows appended after this point are not seen by the scan
+    const auto chunk_size = chunk.size();
+    if (chunk_size == 0) continue;
+
+    const auto statistics = chunk.get_statistics(_column_id);
+    if (statistics && impl->can_prune(*statistics)) continue;
+
+    matches.clear();
+    const auto indexes = chunk.get_indexes({_column_id});
+    if (!indexes.empty()) {
+      scan_index(*indexes.front(), _scan_type, _search_value, matches);
+    } else {
+      impl->scan_segment(*chunk.get_segment(_column_id), chunk_size, matches);
+    }
+
+    const auto mvcc_data = chunk.mvcc_data();
+    if (_transaction_context && mvcc_data) {
+      matches.erase(std::remove_if(matches.begin(), matches.end(),
+                                   [&](const auto chunk_offset) {
+                                     return chunk_offset >= chunk_size ||
+                                            !_transaction_context->is_visible(*mvcc_data, chunk_offset);
+                                   }),
+                    matches.end());
+    }
+    if (matches.empty()) continue;
+
+    output_table->emplace_chunk(_create_output_chunk(input_table, chunk_id, matches));
+  }
+
+  // even an empty result holds a chunk with one (empty) segment per column
+  if (output_table->get_chunk(ChunkID{0}).column_count() == 0) {
+    output_table->emplace_chunk(_create_output_chunk(input_table, ChunkID{0}, {}));
+  }
+
+  return output_table;
+}
+
+Chunk TableScan::_create_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                      const std::vector<ChunkOffset>& matches) {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  auto output_chunk = Chunk{};
+
+  // all columns referencing the same PosList share the PosList of the output as well
+  auto data_pos_list = std::shared_ptr<PosList>{};
+  auto referenced_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto reference_segment =
+        input_chunk.column_count() == 0
+            ? nullptr
+            : std::dynamic_pointer_cast<ReferenceSegment>(input_chunk.get_segment(column_id));
+    if (reference_segment) {
+      auto& pos_list = referenced_pos_lists[reference_segment->pos_list()];
+      if (!pos_list) {
+        const auto& input_pos_list = *reference_segment->pos_list();
+        pos_list = _make_pos_list();
+        pos_list->reserve(matches.size());
+        for (const auto chunk_offset : matches) pos_list->push_back(input_pos_list[chunk_offset]);
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                                  reference_segment->referenced_column_id(), pos_list));
+    } else {
+      if (!data_pos_list) {
+        data_pos_list = _make_pos_list();
+        data_pos_list->reserve(matches.size());
+        for (const auto chunk_offset : matches) data_pos_list->push_back(RowID{chunk_id, chunk_offset});
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, data_pos_list));
+    }
+  }
+
+  return output_chunk;
+}
+
+}  // namespace opossum
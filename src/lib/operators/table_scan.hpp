@@ -13,6 +13,7 @@
 namespace opossum {
 
 class BaseTableScanImpl;
+class Chunk;
 class Table;
 
 class TableScan : public AbstractOperator {
@@ -26,6 +27,15 @@ class TableScan : public AbstractOperator {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  // creates a chunk of ReferenceSegments that point to the given offsets of an input chunk. If the input chunk itself
+  // consists of ReferenceSegments, the output references their referenced table instead.
+  Chunk _create_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                             const std::vector<ChunkOffset>& matches);
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
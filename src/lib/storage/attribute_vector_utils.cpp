@@ -0,0 +1,60 @@
+#include "attribute_vector_utils.hpp"
+
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "fixed_size_attribute_vector.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+uint8_t required_bit_width(const size_t unique_values_count) {
+  auto bit_width = uint8_t{1};
+  while (bit_width < 64 && (size_t{1} << bit_width) < unique_values_count) ++bit_width;
+  return bit_width;
+}
+
+namespace {
+
+template <typename AttributeVector, typename... Args>
+std::shared_ptr<BaseAttributeVector> fill_attribute_vector(const std::vector<ValueID>& value_ids, Args&&... args) {
+  auto attribute_vector = std::make_shared<AttributeVector>(value_ids.size(), std::forward<Args>(args)...);
+  for (auto i = size_t{0}; i < value_ids.size(); ++i) {
+    attribute_vector->set(i, value_ids[i]);
+  }
+  return attribute_vector;
+}
+
+}  // namespace
+
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const AttributeVectorType type,
+                                                           const std::vector<ValueID>& value_ids,
+                                                           const size_t unique_values_count,
+                                                           std::pmr::memory_resource* memory_resource) {
+  Assert(unique_values_count <= size_t{std::numeric_limits<ValueID::base_type>::max()} + 1,
+         "Dictionary has more entries than ValueID can address");
+
+  switch (type) {
+    case AttributeVectorType::FixedSize:
+      if (unique_values_count <= size_t{std::numeric_limits<uint8_t>::max()} + 1) {
+        return fill_attribute_vector<FixedSizeAttributeVector<uint8_t>>(value_ids, memory_resource);
+      }
+      if (unique_values_count <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+        return fill_attribute_vector<FixedSizeAttributeVector<uint16_t>>(value_ids, memory_resource);
+      }
+      return fill_attribute_vector<FixedSizeAttributeVector<uint32_t>>(value_ids, memory_resource);
+    case AttributeVectorType::BitPacked:
+      return fill_attribute_vector<BitPackedAttributeVector>(value_ids, required_bit_width(unique_values_count),
+                                                             memory_resource);
+    case AttributeVectorType::SimdBp128:
+      return std::make_shared<SimdBp128AttributeVector>(value_ids, memory_resource);
+  }
+  Fail("Unknown AttributeVectorType");
+}
+
+}  // namespace opossum
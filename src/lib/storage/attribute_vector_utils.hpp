@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// Selects the physical layout of the attribute vector of a DictionarySegment
+enum class AttributeVectorType {
+  FixedSize,  // uint8_t, uint16_t or uint32_t per value id - fastest random access
+  BitPacked,  // exactly as many bits per value id as the dictionary needs - small footprint
+  SimdBp128   // blocks of 128 value ids packed relative to the block minimum - smallest footprint, fastest decoding
+};
+
+// returns the number of bits needed to represent the value ids 0 .. unique_values_count - 1 (at least one)
+uint8_t required_bit_width(const size_t unique_values_count);
+
+// Creates an attribute vector of the given type holding value_ids. Its width is chosen such that it can hold all value
+// ids of a dictionary with `unique_values_count` entries. Its memory is allocated from memory_resource.
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(
+    const AttributeVectorType type, const std::vector<ValueID>& value_ids, const size_t unique_values_count,
+    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 namespace opossum {
 
 // BaseAttributeVector is the abstract super class for all attribute vectors,
-// e.g., FixedSizeAttributeVector
+// e.g., FixedSizeAttributeVector, BitPackedAttributeVector, or SimdBp128AttributeVector
 class BaseAttributeVector : private Noncopyable {
  public:
   BaseAttributeVector() = default;
@@ -19,6 +19,15 @@ class BaseAttributeVector : private Noncopyable {
   // returns the value id at a given position
   virtual ValueID get(const size_t i) const = 0;
 
+  // writes the value ids at the positions [begin, end) into buffer, which has to hold at least end - begin elements.
+  // Operators should prefer this over get() when they process ranges of rows, as it replaces one virtual call per row
+  // with one per range and allows subclasses to decode whole blocks at once.
+  virtual void decode_into(ValueID* buffer, const size_t begin, const size_t end) const {
+    for (auto i = begin; i < end; ++i) {
+      *buffer++ = get(i);
+    }
+  }
+
   // sets the value id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
@@ -27,5 +36,8 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
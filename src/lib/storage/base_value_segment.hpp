@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Type-erased interface of ValueSegment. It allows, e.g., chunks to copy ranges of values between segments without
+// knowing their data type and without boxing each value into an AllTypeVariant.
+class BaseValueSegment : public BaseSegment {
+ public:
+  // appends the values at the positions [begin, end) of source, which has to be a ValueSegment of the same data type
+  virtual void append_values(const BaseValueSegment& source, ChunkOffset begin, ChunkOffset end) = 0;
+
+  // Overwrites the value at chunk_offset, or the values starting at chunk_offset with the positions [begin, end) of
+  // source. Different positions can be set concurrently, e.g., by the writers of a chunk with MVCC (see Chunk).
+  virtual void set(ChunkOffset chunk_offset, const AllTypeVariant& value) = 0;
+  virtual void set_values(ChunkOffset chunk_offset, const BaseValueSegment& source, ChunkOffset begin,
+                          ChunkOffset end) = 0;
+
+  // Shrinks the segment or appends default values, e.g., to preallocate the rows that are set concurrently. Must not be
+  // called while the segment is being read.
+  virtual void resize(ChunkOffset size) = 0;
+
+  // returns a new segment with the first `size` values, allocated from the same memory resource
+  virtual std::shared_ptr<BaseValueSegment> copy_prefix(ChunkOffset size) const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   std::pmr::memory_resource* memory_resource)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1), _words(memory_resource) {
+  Assert(bit_width > 0 && bit_width <= 32, "BitPackedAttributeVector: bit width has to be in [1, 32]");
+  _words.resize((size * bit_width + BITS_PER_WORD - 1) / BITS_PER_WORD);
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   pmr_vector<uint64_t> words)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1), _words(std::move(words)) {
+  Assert(bit_width > 0 && bit_width <= 32, "BitPackedAttributeVector: bit width has to be in [1, 32]");
+  Assert(_words.size() == (size * bit_width + BITS_PER_WORD - 1) / BITS_PER_WORD,
+         "BitPackedAttributeVector: number of words does not match the size");
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "BitPackedAttributeVector: position out of range");
+  const auto bit_position = i * _bit_width;
+  const auto word_index = bit_position / BITS_PER_WORD;
+  const auto shift = bit_position % BITS_PER_WORD;
+
+  auto value = _words[word_index] >> shift;
+  // the value id continues in the next word
+  if (shift + _bit_width > BITS_PER_WORD) {
+    value |= _words[word_index + 1] << (BITS_PER_WORD - shift);
+  }
+  return ValueID{static_cast<ValueID::base_type>(value & _mask)};
+}
+
+void BitPackedAttributeVector::decode_into(ValueID* buffer, const size_t begin, const size_t end) const {
+  DebugAssert(begin <= end && end <= _size, "BitPackedAttributeVector: range out of bounds");
+  // walk the bit stream sequentially instead of recomputing the word position for every value id
+  auto word_index = begin * _bit_width / BITS_PER_WORD;
+  auto shift = begin * _bit_width % BITS_PER_WORD;
+  for (auto i = begin; i < end; ++i) {
+    auto value = _words[word_index] >> shift;
+    if (shift + _bit_width > BITS_PER_WORD) {
+      value |= _words[word_index + 1] << (BITS_PER_WORD - shift);
+    }
+    *buffer++ = ValueID{static_cast<ValueID::base_type>(value & _mask)};
+
+    shift += _bit_width;
+    if (shift >= BITS_PER_WORD) {
+      shift -= BITS_PER_WORD;
+      ++word_index;
+    }
+  }
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "BitPackedAttributeVector: position out of range");
+  DebugAssert((uint64_t{value_id} & ~_mask) == 0, "BitPackedAttributeVector: value id is too wide");
+  const auto bit_position = i * _bit_width;
+  const auto word_index = bit_position / BITS_PER_WORD;
+  const auto shift = bit_position % BITS_PER_WORD;
+  const auto value = uint64_t{value_id};
+
+  _words[word_index] = (_words[word_index] & ~(_mask << shift)) | (value << shift);
+  if (shift + _bit_width > BITS_PER_WORD) {
+    const auto bits_in_first_word = BITS_PER_WORD - shift;
+    _words[word_index + 1] = (_words[word_index + 1] & ~(_mask >> bits_in_first_word)) | (value >> bits_in_first_word);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+const pmr_vector<uint64_t>& BitPackedAttributeVector::words() const { return _words; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id using exactly `bit_width` bits. The value ids are packed back to back
+// into 64-bit words, so a single value id may span two words. This trades some access speed for the smallest
+// possible footprint, e.g., 3 bits per row for a dictionary with 8 entries.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  // creates an attribute vector holding `size` value ids of `bit_width` bits, all initialized to zero
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                           std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // takes over the words of a vector with `size` value ids of `bit_width` bits as returned by words(), e.g., when
+  // reading a table file
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width, pmr_vector<uint64_t> words);
+
+  ValueID get(const size_t i) const final;
+
+  void decode_into(ValueID* buffer, const size_t begin, const size_t end) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  // returns the number of bytes needed to hold a single value id, i.e., the bit width rounded up to full bytes
+  AttributeVectorWidth width() const final;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // returns the packed value ids
+  const pmr_vector<uint64_t>& words() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const size_t _size;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+  pmr_vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t distinct_count, const size_t bits_per_value) {
+  constexpr auto BITS_PER_BLOCK = WORDS_PER_BLOCK * sizeof(uint32_t) * 8;
+  const auto block_count = std::max(size_t{1}, (distinct_count * bits_per_value + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK);
+  _blocks.resize(block_count);
+}
+
+void BloomFilter::insert(const uint64_t hash) {
+  auto& block = _blocks[_block_index(hash)];
+  const auto mask = _mask(hash);
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    block[word_index] |= mask[word_index];
+  }
+}
+
+bool BloomFilter::may_contain(const uint64_t hash) const {
+  const auto& block = _blocks[_block_index(hash)];
+  const auto mask = _mask(hash);
+  auto matches = true;
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    matches &= (block[word_index] & mask[word_index]) == mask[word_index];
+  }
+  return matches;
+}
+
+size_t BloomFilter::block_count() const { return _blocks.size(); }
+
+size_t BloomFilter::estimate_memory_usage() const { return _blocks.size() * sizeof(Block); }
+
+size_t BloomFilter::_block_index(const uint64_t hash) const {
+  // maps the upper half of the hash to [0, block_count) without a division
+  return ((hash >> 32) * _blocks.size()) >> 32;
+}
+
+BloomFilter::Block BloomFilter::_mask(const uint64_t hash) {
+  static constexpr auto SALTS = std::array<uint32_t, WORDS_PER_BLOCK>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                                      0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                                      0x9efc4947U, 0x5c6bfb31U};
+  auto mask = Block{};
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    // the upper five bits of the salted lower half of the hash select one of the 32 bits of the word
+    mask[word_index] = uint32_t{1} << ((static_cast<uint32_t>(hash) * SALTS[word_index]) >> 27);
+  }
+  return mask;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A blocked Bloom filter, which answers whether a set may contain a value. Each value sets eight bits, all of which
+// lie in the same 256 bit block, so a lookup touches a single cache line. With the default of ten bits per value, about
+// one percent of the lookups for values not in the set return a false positive. The layout follows the split block
+// Bloom filter of Apache Parquet.
+//
+// Values are inserted and looked up by their mixed_hash (see utils/hash.hpp).
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_BITS_PER_VALUE = size_t{10};
+
+  // creates an empty filter sized for the expected number of distinct values
+  explicit BloomFilter(size_t distinct_count, size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  void insert(uint64_t hash);
+
+  // returns false only if no value with this hash has been inserted
+  bool may_contain(uint64_t hash) const;
+
+  size_t block_count() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+  using Block = std::array<uint32_t, WORDS_PER_BLOCK>;
+
+  // returns the block a hash maps to
+  size_t _block_index(uint64_t hash) const;
+
+  // returns the bits a hash sets in each word of its block
+  static Block _mask(uint64_t hash);
+
+  std::vector<Block> _blocks;
+};
+
+}  // namespace opossum
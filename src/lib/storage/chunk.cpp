@@ -1,40 +1,361 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
+#include "mvcc_data.hpp"
+#include "segment_statistics.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+Chunk::Chunk(Chunk&& other) { *this = std::move(other); }
+
+Chunk& Chunk::operator=(Chunk&& other) {
+  const auto lock = std::scoped_lock{_mutex, other._mutex};
+  _segments = std::move(other._segments);
+  _statistics = std::move(other._statistics);
+  _indexes = std::move(other._indexes);
+  _load_segment = std::move(other._load_segment);
+  _lazy_segments_size = other._lazy_segments_size;
+  _mvcc_data = std::move(other._mvcc_data);
+  _accessed = other._accessed.load();
+  return *this;
+}
+
 void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
-  // Implementation goes here
+  const auto lock = std::unique_lock{_mutex};
+  if (_mvcc_data) _preallocate(*segment);
+  _segments.push_back(segment);
+}
+
+void Chunk::add_lazy_segments(const ColumnCount column_count, const ChunkOffset size,
+                              std::function<std::shared_ptr<BaseSegment>(ColumnID)> load) {
+  const auto lock = std::unique_lock{_mutex};
+  Assert(_segments.empty(), "Chunk::add_lazy_segments: chunk already has segments");
+  _segments.resize(column_count);
+  _load_segment = std::move(load);
+  _lazy_segments_size = size;
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
-  // Implementation goes here
+  if (mvcc_data()) {
+    const auto [chunk_offset, row_count] = reserve_rows(1);
+    Assert(row_count == 1, "Chunk::append: chunk is full");
+    try {
+      set_row(chunk_offset, values);
+    } catch (...) {
+      // the row keeps the initial MVCC entries, which hide it from all transactions
+      publish_rows(chunk_offset, row_count);
+      throw;
+    }
+    publish_rows(chunk_offset, row_count);
+    return;
+  }
+
+  const auto lock = std::shared_lock{_mutex};
+  Assert(!_load_segment, "Chunk::append: chunks with lazily loaded segments are immutable");
+  DebugAssert(values.size() == _segments.size(), "Chunk::append: number of values does not match the column count");
+  for (auto column_id = ColumnID{0}; column_id < values.size(); ++column_id) {
+    _segments[column_id]->append(values[column_id]);
+  }
+}
+
+void Chunk::append_columns(const std::vector<std::shared_ptr<BaseSegment>>& columns, const ChunkOffset begin,
+                           const ChunkOffset end) {
+  if (mvcc_data()) {
+    const auto [chunk_offset, row_count] = reserve_rows(end - begin);
+    Assert(row_count == end - begin, "Chunk::append_columns: chunk is full");
+    try {
+      set_rows(chunk_offset, columns, begin, end);
+    } catch (...) {
+      publish_rows(chunk_offset, row_count);
+      throw;
+    }
+    publish_rows(chunk_offset, row_count);
+    return;
+  }
+
+  const auto lock = std::shared_lock{_mutex};
+  Assert(!_load_segment, "Chunk::append_columns: chunks with lazily loaded segments are immutable");
+  Assert(columns.size() == _segments.size(), "Chunk::append_columns: expected one column per segment");
+  for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+    const auto target = std::dynamic_pointer_cast<BaseValueSegment>(_segments[column_id]);
+    const auto source = std::dynamic_pointer_cast<const BaseValueSegment>(columns[column_id]);
+    Assert(target && source, "Chunk::append_columns: only ValueSegments can be appended to ValueSegments");
+    target->append_values(*source, begin, end);
+  }
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count) {
+  const auto mvcc_data = this->mvcc_data();
+  Assert(mvcc_data, "Chunk::reserve_rows: only chunks with MVCC can be appended to concurrently");
+  const auto capacity = static_cast<ChunkOffset>(mvcc_data->tids.size());
+  auto chunk_offset = mvcc_data->reserved.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    reserved_row_count = std::min(row_count, capacity - chunk_offset);
+    if (reserved_row_count == 0) break;
+  } while (!mvcc_data->reserved.compare_exchange_weak(chunk_offset, chunk_offset + reserved_row_count));
+  return {chunk_offset, reserved_row_count};
+}
+
+void Chunk::set_row(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) {
+  const auto lock = std::shared_lock{_mutex};
+  DebugAssert(values.size() == _segments.size(), "Chunk::set_row: number of values does not match the column count");
+  for (auto column_id = ColumnID{0}; column_id < values.size(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<BaseValueSegment>(_segments[column_id]);
+    Assert(segment, "Chunk::set_row: only the values of ValueSegments can be set");
+    segment->set(chunk_offset, values[column_id]);
+  }
+}
+
+void Chunk::set_rows(const ChunkOffset chunk_offset, const std::vector<std::shared_ptr<BaseSegment>>& columns,
+                     const ChunkOffset begin, const ChunkOffset end) {
+  const auto lock = std::shared_lock{_mutex};
+  Assert(columns.size() == _segments.size(), "Chunk::set_rows: expected one column per segment");
+  for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+    const auto target = std::dynamic_pointer_cast<BaseValueSegment>(_segments[column_id]);
+    const auto source = std::dynamic_pointer_cast<const BaseValueSegment>(columns[column_id]);
+    Assert(target && source, "Chunk::set_rows: only ValueSegments can be copied to ValueSegments");
+    target->set_values(chunk_offset, *source, begin, end);
+  }
+}
+
+bool Chunk::publish_rows(const ChunkOffset chunk_offset, const ChunkOffset row_count) {
+  const auto mvcc_data = this->mvcc_data();
+  DebugAssert(mvcc_data, "Chunk::publish_rows: chunk has no MVCC columns");
+  for (auto offset = chunk_offset; offset < chunk_offset + row_count; ++offset) mvcc_data->published[offset] = true;
+
+  // Every writer advances size over the published rows that follow it, including those of other writers. As the flags
+  // are set before size is read, a writer that publishes concurrently either sees these rows or is seen by this one.
+  const auto capacity = static_cast<ChunkOffset>(mvcc_data->published.size());
+  auto size = mvcc_data->size.load();
+  while (true) {
+    auto published_end = size;
+    while (published_end < capacity && mvcc_data->published[published_end].load()) ++published_end;
+    if (published_end == size) return false;
+    if (mvcc_data->size.compare_exchange_weak(size, published_end)) return published_end == capacity;
+  }
+}
+
+void Chunk::finalize() {
+  const auto mvcc_data = this->mvcc_data();
+  if (!mvcc_data) return;
+
+  const auto capacity = static_cast<ChunkOffset>(mvcc_data->tids.size());
+  const auto reserved = mvcc_data->reserved.exchange(capacity);
+  // full chunks, and chunks that are finalized already, need not be shrunk
+  if (reserved == capacity) return;
+  while (mvcc_data->size.load() != reserved) std::this_thread::yield();
+
+  // Readers might still be accessing the segments without locks, so they are replaced by shrunk copies instead of
+  // being shrunk in place. Readers that hold the previous segments keep seeing the published rows in them.
+  auto previous_segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  {
+    const auto lock = std::shared_lock{_mutex};
+    previous_segments = _segments;
+  }
+  auto segments = previous_segments;
+  for (auto& segment : segments) {
+    const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(segment);
+    if (value_segment) segment = value_segment->copy_prefix(reserved);
+  }
+
+  const auto lock = std::unique_lock{_mutex};
+  DebugAssert(_segments == previous_segments, "Chunk::finalize: segments were replaced while the chunk was finalized");
+  _segments = std::move(segments);
+}
+
+bool Chunk::is_finalized() const {
+  const auto lock = std::shared_lock{_mutex};
+  if (!_mvcc_data) return true;
+  const auto capacity = static_cast<ChunkOffset>(_mvcc_data->tids.size());
+  if (_mvcc_data->reserved.load() != capacity) return false;
+  // the segments of a chunk that was finalized before it was full are shrunk to the published rows
+  const auto size = _mvcc_data->size.load();
+  return _segments.empty() || !_segments.front() || _segments.front()->size() == size;
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
-  // Implementation goes here
-  return nullptr;
+  // only written if not set already, so that concurrent readers do not contend for the cache line
+  if (!_accessed.load(std::memory_order_relaxed)) _accessed.store(true, std::memory_order_relaxed);
+
+  {
+    const auto lock = std::shared_lock{_mutex};
+    DebugAssert(column_id < _segments.size(), "Chunk::get_segment: column_id out of range");
+    if (_segments[column_id]) return _segments[column_id];
+  }
+
+  // the segment is loaded on its first access, concurrent readers wait for it
+  const auto lock = std::unique_lock{_mutex};
+  auto& segment = _segments[column_id];
+  if (!segment) {
+    segment = _load_segment(column_id);
+    DebugAssert(segment && segment->size() == _lazy_segments_size, "Chunk::get_segment: loaded segment has wrong size");
+  }
+  return segment;
+}
+
+void Chunk::replace_segments(std::vector<std::shared_ptr<BaseSegment>> segments,
+                             std::vector<std::shared_ptr<const SegmentStatistics>> statistics) {
+  const auto lock = std::unique_lock{_mutex};
+  _replace_segments(std::move(segments), std::move(statistics));
+}
+
+bool Chunk::replace_segments_if_unchanged(const std::vector<std::shared_ptr<BaseSegment>>& expected_segments,
+                                          std::vector<std::shared_ptr<BaseSegment>> segments,
+                                          std::vector<std::shared_ptr<const SegmentStatistics>> statistics) {
+  const auto lock = std::unique_lock{_mutex};
+  if (_segments != expected_segments) return false;
+  _replace_segments(std::move(segments), std::move(statistics));
+  return true;
+}
+
+void Chunk::_replace_segments(std::vector<std::shared_ptr<BaseSegment>> segments,
+                              std::vector<std::shared_ptr<const SegmentStatistics>> statistics) {
+  Assert(segments.size() == _segments.size(), "Chunk::replace_segments: expected one segment per column");
+  DebugAssert(statistics.empty() || statistics.size() == segments.size(),
+              "Chunk::replace_segments: expected one entry per segment");
+  _segments = std::move(segments);
+  _statistics = std::move(statistics);
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& index) { return !index->indexes_only(_segments); }),
+                 _indexes.end());
+  _load_segment = nullptr;
+}
+
+void Chunk::set_statistics(std::vector<std::shared_ptr<const SegmentStatistics>> statistics) {
+  const auto lock = std::unique_lock{_mutex};
+  DebugAssert(statistics.size() == _segments.size(), "Chunk::set_statistics: expected one entry per segment");
+  _statistics = std::move(statistics);
+}
+
+std::shared_ptr<const SegmentStatistics> Chunk::get_statistics(ColumnID column_id) const {
+  const auto lock = std::shared_lock{_mutex};
+  if (_statistics.empty()) return nullptr;
+  DebugAssert(column_id < _statistics.size(), "Chunk::get_statistics: column_id out of range");
+  return _statistics[column_id];
+}
+
+void Chunk::add_index(const std::shared_ptr<BaseIndex>& index) {
+  const auto lock = std::unique_lock{_mutex};
+  _indexes.push_back(index);
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto column_id : column_ids) segments.push_back(get_segment(column_id));
+
+  const auto lock = std::shared_lock{_mutex};
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>{};
+  std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(indexes),
+               [&](const auto& index) { return index->is_index_for(segments); });
+  return indexes;
+}
+
+bool Chunk::is_evictable() const {
+  const auto lock = std::shared_lock{_mutex};
+  if (_segments.empty() || !_indexes.empty()) return false;
+  if (_load_segment) return true;
+  return std::none_of(_segments.cbegin(), _segments.cend(), [](const auto& segment) {
+    return std::dynamic_pointer_cast<const BaseValueSegment>(segment) != nullptr;
+  });
+}
+
+bool Chunk::evict(std::function<std::shared_ptr<BaseSegment>(ColumnID)> load) {
+  // readers and writers of the chunk are not waited for, the chunk is simply not evicted this time
+  const auto lock = std::unique_lock{_mutex, std::try_to_lock};
+  if (!lock.owns_lock() || _is_pinned()) return false;
+  DebugAssert(load || _load_segment, "Chunk::evict: segments cannot be loaded again");
+  _evict(std::move(load));
+  return true;
+}
+
+bool Chunk::spill_and_evict(
+    const std::function<std::function<std::shared_ptr<BaseSegment>(ColumnID)>(
+        const std::vector<std::shared_ptr<BaseSegment>>&)>& spill) {
+  const auto lock = std::unique_lock{_mutex, std::try_to_lock};
+  if (!lock.owns_lock() || _is_pinned()) return false;
+  DebugAssert(!_load_segment, "Chunk::spill_and_evict: the chunk has a loader already");
+
+  auto load = spill(_segments);
+  if (!load) return false;
+  _evict(std::move(load));
+  return true;
+}
+
+bool Chunk::_is_pinned() const {
+  // the chunk holds one reference itself, every other one pins the segment
+  return std::any_of(_segments.cbegin(), _segments.cend(),
+                     [](const auto& segment) { return segment && segment.use_count() > 1; });
+}
+
+void Chunk::_evict(std::function<std::shared_ptr<BaseSegment>(ColumnID)> load) {
+  for (const auto& segment : _segments) {
+    if (segment) _lazy_segments_size = segment->size();
+  }
+  std::fill(_segments.begin(), _segments.end(), nullptr);
+  if (load) _load_segment = std::move(load);
+}
+
+bool Chunk::has_segment_loader() const {
+  const auto lock = std::shared_lock{_mutex};
+  return static_cast<bool>(_load_segment);
+}
+
+bool Chunk::test_and_clear_accessed() { return _accessed.exchange(false); }
+
+size_t Chunk::memory_usage() const {
+  const auto lock = std::shared_lock{_mutex};
+  auto memory_usage = size_t{0};
+  for (const auto& segment : _segments) {
+    if (segment) memory_usage += segment->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+void Chunk::set_mvcc_data(std::shared_ptr<MvccData> mvcc_data) {
+  const auto lock = std::unique_lock{_mutex};
+  _mvcc_data = std::move(mvcc_data);
+  for (const auto& segment : _segments) _preallocate(*segment);
+}
+
+void Chunk::_preallocate(BaseSegment& segment) const {
+  auto* value_segment = dynamic_cast<BaseValueSegment*>(&segment);
+  Assert(value_segment && value_segment->size() == 0, "Chunk: chunks with MVCC start with empty ValueSegments");
+  value_segment->resize(static_cast<ChunkOffset>(_mvcc_data->tids.size()));
+}
+
+std::shared_ptr<MvccData> Chunk::mvcc_data() const {
+  const auto lock = std::shared_lock{_mutex};
+  return _mvcc_data;
 }
 
 ColumnCount Chunk::column_count() const {
-  // Implementation goes here
-  return ColumnCount{0};
+  const auto lock = std::shared_lock{_mutex};
+  return ColumnCount{static_cast<ColumnCount::base_type>(_segments.size())};
 }
 
 ChunkOffset Chunk::size() const {
-  // Implementation goes here
-  return 0;
+  const auto lock = std::shared_lock{_mutex};
+  if (_mvcc_data) return _mvcc_data->size;
+  if (_segments.empty()) return 0;
+  if (!_segments.front()) return _lazy_segments_size;
+  return _segments.front()->size();
 }
 
 }  // namespace opossum
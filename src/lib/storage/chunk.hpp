@@ -4,8 +4,10 @@
 #include <shared_mutex>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,33 +17,170 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+struct MvccData;
+struct SegmentStatistics;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
 //
 // Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
+//
+// The segments of a chunk can be replaced while it is being read, e.g., by compressed ones (see replace_segments).
+// Readers keep the segments they obtained from get_segment alive and thereby see a consistent state.
+//
+// Immutable chunks can be evicted, i.e., their segments are released and loaded again on their next access. A segment
+// that is held outside of the chunk, e.g., by a running scan, is pinned, and chunks with pinned segments are not
+// evicted.
+//
+// Chunks of tables with MVCC have MvccData, which also bounds the rows that readers see. Their ValueSegments hold a
+// value for each row of the MVCC columns upfront, so that several writers can set the values of the rows they reserved
+// concurrently (see reserve_rows), and readers can read the published rows without locks in the meantime.
 class Chunk : private Noncopyable {
  public:
   Chunk() = default;
+  Chunk(Chunk&& other);
+  Chunk& operator=(Chunk&& other);
 
   // adds a segment to the "right" of the chunk
   void add_segment(std::shared_ptr<BaseSegment> segment);
 
+  // Adds column_count segments that hold `size` rows each and are created by load(column_id) when they are accessed
+  // for the first time, e.g., from a memory-mapped file. Such chunks cannot be appended to.
+  void add_lazy_segments(const ColumnCount column_count, const ChunkOffset size,
+                         std::function<std::shared_ptr<BaseSegment>(ColumnID)> load);
+
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   ColumnCount column_count() const;
 
-  // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
+  // returns the number of rows (cannot exceed ChunkOffset (uint32_t)), for chunks with MVCC the published ones
   ChunkOffset size() const;
 
   // adds a new row, given as a list of values, to the chunk
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and should be used for testing purposes only. It is only thread-safe for chunks with MVCC.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Adds the rows [begin, end) of the given columns, one ValueSegment of the same data type per segment of this chunk.
+  // The values are copied column by column, which makes this the fast way of inserting many rows.
+  void append_columns(const std::vector<std::shared_ptr<BaseSegment>>& columns, ChunkOffset begin, ChunkOffset end);
+
+  // Reserves up to row_count rows at the end of a chunk with MVCC without locking. The writer then sets their values
+  // and MVCC entries and publishes them. Returns the offset of the first reserved row and the number of reserved rows,
+  // which is 0 if the chunk is full.
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count);
+
+  // Sets the values of a reserved row, or of the reserved rows starting at chunk_offset to the rows [begin, end) of the
+  // given ValueSegments.
+  void set_row(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values);
+  void set_rows(const ChunkOffset chunk_offset, const std::vector<std::shared_ptr<BaseSegment>>& columns,
+                const ChunkOffset begin, const ChunkOffset end);
+
+  // Marks the reserved rows [chunk_offset, chunk_offset + row_count) as written. Readers see the rows up to the first
+  // one that is not published yet, which each writer advances without waiting for the others: the rows of a writer
+  // that is still busy simply become visible once it publishes them. Rows whose values could not be set have to be
+  // published nevertheless, with MVCC entries that hide them from all transactions. Returns whether this call
+  // published the last row of a full chunk, i.e., whether the caller is the one to close it.
+  bool publish_rows(const ChunkOffset chunk_offset, const ChunkOffset row_count);
+
+  // Ends the appends to a chunk with MVCC: no more rows can be reserved, and once the reserved ones are published, the
+  // ValueSegments are replaced by copies that only hold the published rows. Waits for the writers of reserved rows, so
+  // it should not be called while rows are appended.
+  void finalize();
+
+  // Returns whether the rows of a chunk with MVCC are final, i.e., whether it is full or finalized and all its rows are
+  // published and its segments hold exactly these rows. Chunks without MVCC are always considered final.
+  bool is_finalized() const;
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Atomically replaces all segments and their statistics, e.g., by their compressed counterparts holding the same
+  // values. Indexes on replaced segments are dropped, indexes on segments that are passed again are kept. The segments
+  // are no longer loaded lazily.
+  void replace_segments(std::vector<std::shared_ptr<BaseSegment>> segments,
+                        std::vector<std::shared_ptr<const SegmentStatistics>> statistics);
+
+  // Same as replace_segments, but only if the chunk still holds expected_segments, e.g., the segments that were
+  // compressed in the background. Returns whether the segments were replaced.
+  bool replace_segments_if_unchanged(const std::vector<std::shared_ptr<BaseSegment>>& expected_segments,
+                                     std::vector<std::shared_ptr<BaseSegment>> segments,
+                                     std::vector<std::shared_ptr<const SegmentStatistics>> statistics);
+
+  // sets the pruning statistics, one entry per segment
+  void set_statistics(std::vector<std::shared_ptr<const SegmentStatistics>> statistics);
+
+  // Returns the pruning statistics of a segment, or nullptr if none have been created.
+  // Statistics are created by the table once a chunk is full or compressed and describe immutable segments only.
+  std::shared_ptr<const SegmentStatistics> get_statistics(ColumnID column_id) const;
+
+  // adds an index, which has to be built on segments of this chunk
+  void add_index(const std::shared_ptr<BaseIndex>& index);
+
+  // returns all indexes that are built on exactly the segments of the given columns, in the same order
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // Returns whether the chunk can be evicted: it is not empty, has no indexes, and its segments are loaded lazily or
+  // are all encoded, i.e., the chunk is not appended to anymore.
+  bool is_evictable() const;
+
+  // Releases the segments of an evictable chunk. They are created by load(column_id) on their next access, or by the
+  // current loader if load is empty. Returns false without evicting the chunk if a segment is pinned or the chunk is
+  // being modified.
+  bool evict(std::function<std::shared_ptr<BaseSegment>(ColumnID)> load = nullptr);
+
+  // Like evict, but the loader is created by spill(segments) only once the chunk turned out to be evictable, e.g., by
+  // writing the segments to a file, so that nothing is written for pinned or busy chunks. Readers of the chunk wait
+  // for spill. If spill returns an empty function, the chunk is kept. The segments are not read through get_segment,
+  // so the chunk is not marked as accessed.
+  bool spill_and_evict(
+      const std::function<std::function<std::shared_ptr<BaseSegment>(ColumnID)>(
+          const std::vector<std::shared_ptr<BaseSegment>>&)>& spill);
+
+  // returns whether the chunk has a loader for its segments, i.e., whether it was lazily loaded or evicted before
+  bool has_segment_loader() const;
+
+  // returns whether a segment was accessed since the last call, which is used for the clock replacement of evictions
+  bool test_and_clear_accessed();
+
+  // returns the estimated memory usage of the segments that are currently loaded
+  size_t memory_usage() const;
+
+  // Adds the MVCC columns, which have to be set before rows are appended. The ValueSegments of the chunk are resized
+  // to the capacity of the MVCC columns, which limits the number of rows.
+  void set_mvcc_data(std::shared_ptr<MvccData> mvcc_data);
+
+  // returns the MVCC columns, or nullptr if all rows of the chunk are visible to all transactions
+  std::shared_ptr<MvccData> mvcc_data() const;
+
  protected:
-  // Implementation goes here
+  // replace_segments without taking the lock
+  void _replace_segments(std::vector<std::shared_ptr<BaseSegment>> segments,
+                         std::vector<std::shared_ptr<const SegmentStatistics>> statistics);
+
+  // resizes a ValueSegment to the capacity of the MVCC columns
+  void _preallocate(BaseSegment& segment) const;
+
+  // returns whether a segment is held outside of the chunk, requires the lock
+  bool _is_pinned() const;
+
+  // releases the segments and sets load as the loader if it is not empty, requires the unique lock
+  void _evict(std::function<std::shared_ptr<BaseSegment>(ColumnID)> load);
+
+  // mutable, as get_segment loads lazy segments
+  mutable std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<const SegmentStatistics>> _statistics;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+
+  // creates the segments that have not been accessed yet (nullptr in _segments), see add_lazy_segments
+  std::function<std::shared_ptr<BaseSegment>(ColumnID)> _load_segment;
+  ChunkOffset _lazy_segments_size = 0;
+
+  std::shared_ptr<MvccData> _mvcc_data;
+
+  // set by get_segment, cleared by test_and_clear_accessed
+  mutable std::atomic<bool> _accessed{false};
+
+  // protects the above vectors, but not the contents of the segments
+  mutable std::shared_mutex _mutex;
 };
 
 }  // namespace opossum
@@ -0,0 +1,38 @@
+#include "contiguous_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ContiguousStringVector::ContiguousStringVector(const std::vector<std::string>& values,
+                                               std::pmr::memory_resource* memory_resource)
+    : _chars(memory_resource), _offsets(1, uint32_t{0}, memory_resource) {
+  auto char_count = size_t{0};
+  for (const auto& value : values) char_count += value.size();
+  Assert(char_count <= std::numeric_limits<uint32_t>::max(), "ContiguousStringVector: strings exceed 4 GB");
+
+  _chars.reserve(char_count);
+  _offsets.reserve(values.size() + 1);
+  for (const auto& value : values) {
+    _chars.insert(_chars.end(), value.cbegin(), value.cend());
+    _offsets.push_back(static_cast<uint32_t>(_chars.size()));
+  }
+}
+
+ContiguousStringVector::ContiguousStringVector(pmr_vector<char> chars, pmr_vector<uint32_t> offsets)
+    : _chars(std::move(chars)), _offsets(std::move(offsets)) {
+  Assert(!_offsets.empty() && _offsets.front() == 0 && _offsets.back() == _chars.size(),
+         "ContiguousStringVector: offsets do not match the buffer");
+}
+
+size_t ContiguousStringVector::estimate_memory_usage() const {
+  return _chars.size() * sizeof(char) + _offsets.size() * sizeof(uint32_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// ContiguousStringVector is an immutable vector of strings that stores all characters in a single buffer. An offsets
+// array marks where each string starts, so accessing a string does not require following a pointer per entry and the
+// vector needs only two allocations in total. Strings are returned as std::string_views into the buffer.
+class ContiguousStringVector {
+ public:
+  class Iterator : public boost::iterator_facade<Iterator, std::string_view, std::random_access_iterator_tag,
+                                                 std::string_view> {
+   public:
+    Iterator() = default;
+    Iterator(const ContiguousStringVector* vector, const size_t index) : _vector(vector), _index(index) {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    std::string_view dereference() const { return (*_vector)[_index]; }
+    bool equal(const Iterator& other) const { return _index == other._index; }
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    const ContiguousStringVector* _vector = nullptr;
+    size_t _index = 0;
+  };
+
+  ContiguousStringVector() = default;
+
+  // copies the given strings into a single buffer allocated from memory_resource
+  explicit ContiguousStringVector(const std::vector<std::string>& values,
+                                  std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // takes over a buffer and its offsets as returned by chars() and offsets(), e.g., when reading a table file
+  ContiguousStringVector(pmr_vector<char> chars, pmr_vector<uint32_t> offsets);
+
+  std::string_view operator[](const size_t index) const {
+    return std::string_view{_chars.data() + _offsets[index], _offsets[index + 1] - _offsets[index]};
+  }
+
+  Iterator begin() const { return Iterator{this, 0}; }
+  Iterator end() const { return Iterator{this, size()}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+  size_t size() const { return _offsets.size() - 1; }
+  bool empty() const { return size() == 0; }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+  // return the underlying buffer and the offsets of the strings in it
+  const pmr_vector<char>& chars() const { return _chars; }
+  const pmr_vector<uint32_t>& offsets() const { return _offsets; }
+
+ protected:
+  pmr_vector<char> _chars;
+  // the i-th string is stored in [_offsets[i], _offsets[i + 1]), hence there is one offset more than strings
+  pmr_vector<uint32_t> _offsets{0};
+};
+
+}  // namespace opossum
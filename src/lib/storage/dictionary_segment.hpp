@@ -1,79 +1,182 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "attribute_vector_utils.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_dictionary_segment.hpp"
+#include "contiguous_string_vector.hpp"
+#include "front_coded_string_vector.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/radix_sort.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
-class BaseAttributeVector;
-class BaseSegment;
-
 // Even though ValueIDs do not have to use the full width of ValueID (uint32_t), this will also work for smaller ValueID
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// By default, strings are stored in a single contiguous buffer to avoid one allocation per entry and pointer chasing
+// during binary searches. All other types use a plain vector.
 template <typename T>
-class DictionarySegment : public BaseSegment {
+using DefaultDictionary = std::conditional_t<std::is_same_v<T, std::string>, ContiguousStringVector, pmr_vector<T>>;
+
+// Dictionary is a specific segment type that stores all its values in a vector
+template <typename T, typename DictionaryType = DefaultDictionary<T>>
+class DictionarySegment : public BaseDictionarySegment {
  public:
+  using Dictionary = DictionaryType;
+
+  // const T& for vectors, std::string_view for ContiguousStringVectors, and std::string for FrontCodedStringVectors
+  using ValueReference = decltype(std::declval<const Dictionary&>()[0]);
+
   /**
    * Creates a Dictionary segment from a given value segment.
+   * The width of the attribute vector is derived from the number of unique values, its layout can be chosen by
+   * attribute_vector_type. The dictionary and the attribute vector are allocated from memory_resource, except for
+   * front-coded dictionaries.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment);
-
-  // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
-  // the DictionarySegment in this file. Replace the method signatures with actual implementations.
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const AttributeVectorType attribute_vector_type = AttributeVectorType::FixedSize,
+                             std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource()) {
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+    Assert(value_segment, "DictionarySegment can only be created from a ValueSegment of the same type");
+    const auto& values = value_segment->values();
+
+    // Sorting the positions by their values groups equal values, so that a single pass over the sorted positions builds
+    // the dictionary and assigns the value ids - without a binary search in the dictionary per row. Integers are radix
+    // sorted together with their positions, other types sort the positions by comparing the values they refer to.
+    // A pmr_vector dictionary takes over the sorted values, which are therefore allocated from memory_resource.
+    auto sorted_values = [&] {
+      if constexpr (std::is_same_v<Dictionary, pmr_vector<T>>) {
+        return pmr_vector<T>{memory_resource};
+      } else {
+        return std::vector<T>{};
+      }
+    }();
+    auto value_ids = std::vector<ValueID>(values.size());
+    const auto assign_value_id = [&](const T& value, const ChunkOffset chunk_offset) {
+      if (sorted_values.empty() || sorted_values.back() != value) sorted_values.push_back(value);
+      value_ids[chunk_offset] = ValueID{static_cast<ValueID::base_type>(sorted_values.size() - 1)};
+    };
+
+    if constexpr (std::is_integral_v<T>) {
+      auto entries = std::vector<std::pair<T, ChunkOffset>>(values.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+        entries[chunk_offset] = {values[chunk_offset], chunk_offset};
+      }
+      radix_sort_by_key(entries);
+      for (const auto& [value, chunk_offset] : entries) assign_value_id(value, chunk_offset);
+    } else {
+      auto positions = std::vector<ChunkOffset>(values.size());
+      std::iota(positions.begin(), positions.end(), ChunkOffset{0});
+      std::sort(positions.begin(), positions.end(),
+                [&](const ChunkOffset lhs, const ChunkOffset rhs) { return values[lhs] < values[rhs]; });
+      for (const auto chunk_offset : positions) assign_value_id(values[chunk_offset], chunk_offset);
+    }
+
+    if constexpr (std::is_same_v<Dictionary, pmr_vector<T>>) {
+      sorted_values.shrink_to_fit();
+      _dictionary = std::make_shared<Dictionary>(std::move(sorted_values));
+    } else if constexpr (std::is_same_v<Dictionary, ContiguousStringVector>) {
+      _dictionary = std::make_shared<Dictionary>(sorted_values, memory_resource);
+    } else {
+      _dictionary = std::make_shared<Dictionary>(sorted_values);
+    }
+    _attribute_vector = make_attribute_vector(attribute_vector_type, value_ids, _dictionary->size(), memory_resource);
+  }
+
+  // creates a segment from an existing sorted dictionary and an attribute vector of value ids into it
+  DictionarySegment(std::shared_ptr<Dictionary> dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector)
+      : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {}
 
   // return the value at a certain position. If you want to write efficient operators, back off!
-  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override { return get(chunk_offset); }
 
   // return the value at a certain position.
-  T get(const size_t chunk_offset) const;
+  T get(const size_t chunk_offset) const { return T{value_by_value_id(_attribute_vector->get(chunk_offset))}; }
 
   // dictionary segments are immutable
-  void append(const AllTypeVariant& val) override;
+  void append(const AllTypeVariant& val) override { Fail("DictionarySegment is immutable"); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const;
+  std::shared_ptr<const Dictionary> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const final { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  ValueReference value_by_value_id(ValueID value_id) const {
+    DebugAssert(value_id < _dictionary->size(), "DictionarySegment: value id out of range");
+    return (*_dictionary)[value_id];
+  }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
-  ValueID lower_bound(T value) const;
+  ValueID lower_bound(T value) const {
+    if constexpr (std::is_same_v<Dictionary, FrontCodedStringVector>) {
+      return _to_value_id(_dictionary->lower_bound(value));
+    } else {
+      return _to_value_id(std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin());
+    }
+  }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const final { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
-  ValueID upper_bound(T value) const;
+  ValueID upper_bound(T value) const {
+    if constexpr (std::is_same_v<Dictionary, FrontCodedStringVector>) {
+      return _to_value_id(_dictionary->upper_bound(value));
+    } else {
+      return _to_value_id(std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin());
+    }
+  }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const final { return upper_bound(type_cast<T>(value)); }
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const;
+  size_t unique_values_count() const final { return _dictionary->size(); }
 
   // return the number of entries
-  ChunkOffset size() const override;
+  ChunkOffset size() const override { return static_cast<ChunkOffset>(_attribute_vector->size()); }
 
   // returns the calculated memory usage
-  size_t estimate_memory_usage() const final;
+  size_t estimate_memory_usage() const final {
+    if constexpr (std::is_same_v<Dictionary, pmr_vector<T>>) {
+      return sizeof(T) * _dictionary->size() + _attribute_vector->estimate_memory_usage();
+    } else {
+      return _dictionary->estimate_memory_usage() + _attribute_vector->estimate_memory_usage();
+    }
+  }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // converts a position in the dictionary into a ValueID, or INVALID_VALUE_ID if it is past the end
+  ValueID _to_value_id(const size_t index) const {
+    if (index == _dictionary->size()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(index)};
+  }
+
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
+// A DictionarySegment whose sorted dictionary is prefix-compressed, see FrontCodedStringVector
+using FrontCodedDictionarySegment = DictionarySegment<std::string, FrontCodedStringVector>;
+
 }  // namespace opossum
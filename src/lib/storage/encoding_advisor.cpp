@@ -0,0 +1,218 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "frame_of_reference_segment.hpp"
+#include "front_coded_string_vector.hpp"
+#include "resolve_type.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto SAMPLE_WINDOW_SIZE = size_t{512};
+constexpr auto SAMPLE_WINDOW_COUNT = size_t{8};
+
+// Properties of a segment, extrapolated from a sample
+template <typename T>
+struct SegmentProfile {
+  size_t row_count = 0;
+  size_t distinct_count = 0;
+  size_t run_count = 0;
+
+  // integral types only: bits of the offsets within frame of reference blocks, or no value if the offsets do not fit
+  // into 32 bits
+  std::optional<uint8_t> frame_of_reference_bit_width;
+
+  // strings only
+  double average_length = 0.0;
+  double average_shared_prefix_length = 0.0;
+};
+
+// number of bits needed for the numbers 0 .. max_value
+uint8_t bit_width_of(const uint64_t max_value) {
+  return max_value == 0 ? 1 : static_cast<uint8_t>(64 - __builtin_clzll(max_value));
+}
+
+size_t bit_packed_size(const size_t row_count, const uint8_t bit_width) {
+  return (row_count * bit_width + 63) / 64 * sizeof(uint64_t);
+}
+
+// packed words plus the reference, bit width, and word offset that a SimdBp128AttributeVector keeps per block
+size_t simd_bp128_size(const size_t row_count, const uint8_t bit_width) {
+  constexpr auto BLOCK_SIZE = SimdBp128AttributeVector::BLOCK_SIZE;
+  const auto block_count = (row_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  return (row_count * bit_width + 31) / 32 * sizeof(uint32_t) +
+         block_count * (sizeof(ValueID::base_type) + sizeof(uint8_t) + sizeof(size_t));
+}
+
+template <typename T>
+SegmentProfile<T> profile_segment(const pmr_vector<T>& values) {
+  auto profile = SegmentProfile<T>{};
+  profile.row_count = values.size();
+
+  // the sample consists of evenly spread windows, or of all rows of small segments
+  const auto window_count =
+      std::min(SAMPLE_WINDOW_COUNT, (values.size() + SAMPLE_WINDOW_SIZE - 1) / SAMPLE_WINDOW_SIZE);
+  auto sample = std::vector<T>{};
+  sample.reserve(window_count * SAMPLE_WINDOW_SIZE);
+  auto sampled_run_starts = size_t{0};
+  auto max_block_range = uint64_t{0};
+  for (auto window_index = size_t{0}; window_index < window_count; ++window_index) {
+    const auto window_begin = values.size() * window_index / window_count;
+    const auto window_end = std::min(window_begin + SAMPLE_WINDOW_SIZE, values.size());
+    for (auto row = window_begin; row < window_end; ++row) {
+      sample.push_back(values[row]);
+      if (row == 0 || values[row] != values[row - 1]) ++sampled_run_starts;
+    }
+    if constexpr (std::is_integral_v<T>) {
+      constexpr auto BLOCK_SIZE = SimdBp128AttributeVector::BLOCK_SIZE;
+      for (auto block_begin = window_begin; block_begin < window_end; block_begin += BLOCK_SIZE) {
+        const auto block_end = std::min(block_begin + BLOCK_SIZE, window_end);
+        const auto [min, max] = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+        max_block_range = std::max(max_block_range, static_cast<uint64_t>(*max) - static_cast<uint64_t>(*min));
+      }
+    }
+  }
+  if (sample.empty()) return profile;
+
+  const auto scale = static_cast<double>(values.size()) / static_cast<double>(sample.size());
+  profile.run_count = static_cast<size_t>(std::ceil(sampled_run_starts * scale));
+
+  // Values seen once or twice in the sample hint at the number of values that were not sampled at all. This is the
+  // bias-corrected Chao1 estimator (Chao, 1984), which is exact if the whole segment is sampled.
+  auto frequencies = std::unordered_map<T, size_t>{};
+  for (const auto& value : sample) ++frequencies[value];
+  auto estimated_distinct_count = static_cast<double>(frequencies.size());
+  if (sample.size() < values.size()) {
+    auto singletons = size_t{0};
+    auto doubletons = size_t{0};
+    for (const auto& [value, frequency] : frequencies) {
+      if (frequency == 1) ++singletons;
+      if (frequency == 2) ++doubletons;
+    }
+    estimated_distinct_count += static_cast<double>(singletons) * static_cast<double>(singletons - (singletons > 0)) /
+                                (2.0 * static_cast<double>(doubletons + 1));
+  }
+  profile.distinct_count = std::min(values.size(), static_cast<size_t>(std::llround(estimated_distinct_count)));
+
+  if constexpr (std::is_integral_v<T>) {
+    // the offsets of the frame of reference encoding are packed per 128 rows, so their width is estimated from the
+    // largest range of the sampled 128-row blocks. Ranges beyond 32 bit are not supported by the encoding, so the
+    // global range is checked.
+    const auto [min, max] = std::minmax_element(values.cbegin(), values.cend());
+    const auto global_range = static_cast<uint64_t>(*max) - static_cast<uint64_t>(*min);
+    if (global_range <= std::numeric_limits<uint32_t>::max()) {
+      profile.frame_of_reference_bit_width = bit_width_of(std::min(global_range, max_block_range));
+    }
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto distinct_values = std::vector<std::string>{};
+    distinct_values.reserve(frequencies.size());
+    for (const auto& [value, frequency] : frequencies) distinct_values.push_back(value);
+    std::sort(distinct_values.begin(), distinct_values.end());
+
+    auto total_length = size_t{0};
+    auto total_shared_prefix_length = size_t{0};
+    for (auto index = size_t{0}; index < distinct_values.size(); ++index) {
+      total_length += distinct_values[index].size();
+      if (index == 0) continue;
+      const auto& previous = distinct_values[index - 1];
+      const auto& current = distinct_values[index];
+      const auto mismatch = std::mismatch(previous.cbegin(), previous.cend(), current.cbegin(), current.cend());
+      total_shared_prefix_length += static_cast<size_t>(mismatch.first - previous.cbegin());
+    }
+    profile.average_length = static_cast<double>(total_length) / static_cast<double>(distinct_values.size());
+    profile.average_shared_prefix_length =
+        static_cast<double>(total_shared_prefix_length) / static_cast<double>(distinct_values.size());
+  }
+  return profile;
+}
+
+template <typename T>
+size_t estimate_dictionary_size(const SegmentProfile<T>& profile) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // ContiguousStringVector: characters plus one offset per string
+    const auto character_count = static_cast<size_t>(std::ceil(profile.average_length * profile.distinct_count));
+    return character_count + (profile.distinct_count + 1) * sizeof(uint32_t);
+  } else {
+    return profile.distinct_count * sizeof(T);
+  }
+}
+
+template <typename T>
+size_t estimate_front_coded_dictionary_size(const SegmentProfile<T>& profile) {
+  // each string stores its suffix and two length bytes, the head of each block stores the entire string and one
+  // length byte, and each block has an offset
+  const auto block_count = (profile.distinct_count + FrontCodedStringVector::DEFAULT_BLOCK_SIZE - 1) /
+                           FrontCodedStringVector::DEFAULT_BLOCK_SIZE;
+  const auto suffix_length = profile.average_length - profile.average_shared_prefix_length;
+  const auto data_size = profile.distinct_count * (suffix_length + 2.0) +
+                         block_count * (profile.average_shared_prefix_length - 1.0);
+  return static_cast<size_t>(std::ceil(std::max(data_size, 0.0))) + block_count * sizeof(uint32_t);
+}
+
+template <typename T>
+EncodingAdvice advise_encoding(const ValueSegment<T>& value_segment) {
+  const auto profile = profile_segment(value_segment.values());
+  const auto row_count = profile.row_count;
+
+  // candidates in the order of preference on ties
+  auto candidates = std::vector<EncodingAdvice>{};
+
+  const auto value_id_bit_width = required_bit_width(profile.distinct_count);
+  const auto fixed_size_width = value_id_bit_width <= 8 ? 1 : value_id_bit_width <= 16 ? 2 : 4;
+  const auto dictionary_size = estimate_dictionary_size(profile);
+  candidates.push_back({{EncodingType::Dictionary, AttributeVectorType::FixedSize},
+                        dictionary_size + row_count * fixed_size_width});
+  candidates.push_back({{EncodingType::RunLength, AttributeVectorType::FixedSize},
+                        profile.run_count * (sizeof(T) + sizeof(ChunkOffset))});
+
+  if constexpr (std::is_integral_v<T>) {
+    if (profile.frame_of_reference_bit_width) {
+      const auto block_count =
+          (row_count + FrameOfReferenceSegment<T>::BLOCK_SIZE - 1) / FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      candidates.push_back(
+          {{EncodingType::FrameOfReference, AttributeVectorType::FixedSize},
+           block_count * sizeof(T) + simd_bp128_size(row_count, *profile.frame_of_reference_bit_width)});
+    }
+  }
+
+  candidates.push_back({{EncodingType::Dictionary, AttributeVectorType::BitPacked},
+                        dictionary_size + bit_packed_size(row_count, value_id_bit_width)});
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    candidates.push_back({{EncodingType::FrontCodedDictionary, AttributeVectorType::FixedSize},
+                          estimate_front_coded_dictionary_size(profile) + row_count * fixed_size_width});
+  }
+
+  return *std::min_element(candidates.cbegin(), candidates.cend(), [](const auto& lhs, const auto& rhs) {
+    return lhs.estimated_memory_usage < rhs.estimated_memory_usage;
+  });
+}
+
+}  // namespace
+
+EncodingAdvice advise_encoding(const std::string& data_type, const BaseSegment& value_segment) {
+  auto advice = EncodingAdvice{};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto typed_segment = dynamic_cast<const ValueSegment<Type>*>(&value_segment);
+    Assert(typed_segment, "The encoding advisor requires a ValueSegment of type " + data_type);
+    advice = advise_encoding(*typed_segment);
+  });
+  return advice;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "attribute_vector_utils.hpp"
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// The complete encoding of a segment. The attribute vector type only applies to dictionary encodings. The width of
+// the attribute vector follows from the number of distinct values.
+struct SegmentEncodingSpec {
+  EncodingType encoding_type = EncodingType::Dictionary;
+  AttributeVectorType attribute_vector_type = AttributeVectorType::FixedSize;
+};
+
+// The encoding the advisor chose for a segment and the memory usage it expects after encoding
+struct EncodingAdvice {
+  SegmentEncodingSpec spec;
+  size_t estimated_memory_usage;
+};
+
+// Result of Table::compress_chunk_automatically for one column
+struct SegmentEncodingReport {
+  ColumnID column_id;
+  SegmentEncodingSpec spec;
+  size_t estimated_memory_usage;
+  size_t actual_memory_usage;
+};
+
+// Chooses the encoding with the smallest memory footprint for a ValueSegment of the given data type. The advisor reads
+// a sample of evenly spread windows of consecutive rows, so that runs are preserved, and extrapolates the number of
+// distinct values, the number of runs, the ranges of frame of reference blocks, and the string lengths from it. The
+// memory usage of each encoding supported by the data type is then estimated the same way the encoded segments
+// compute their estimate_memory_usage(). On ties, the encoding that is faster to scan wins.
+EncodingAdvice advise_encoding(const std::string& data_type, const BaseSegment& value_segment);
+
+}  // namespace opossum
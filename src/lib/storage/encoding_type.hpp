@@ -0,0 +1,13 @@
+#pragma once
+
+namespace opossum {
+
+// The encodings a ValueSegment can be compressed into, see Table::compress_chunk
+enum class EncodingType {
+  Dictionary,           // DictionarySegment - sorted dictionary plus attribute vector, good for low cardinalities
+  RunLength,            // RunLengthSegment - one value per run of equal values, good for sorted or clustered data
+  FrameOfReference,     // FrameOfReferenceSegment - bit-packed offsets to block minima, int and long only
+  FrontCodedDictionary  // FrontCodedDictionarySegment - prefix-compressed dictionary, string only
+};
+
+}  // namespace opossum
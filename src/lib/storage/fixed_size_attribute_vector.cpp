@@ -0,0 +1,61 @@
+#include "fixed_size_attribute_vector.hpp"
+
+#include <limits>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(const size_t size,
+                                                            std::pmr::memory_resource* memory_resource)
+    : _values(size, memory_resource) {}
+
+template <typename uintX_t>
+ValueID FixedSizeAttributeVector<uintX_t>::get(const size_t i) const {
+  DebugAssert(i < _values.size(), "FixedSizeAttributeVector: position out of range");
+  return ValueID{_values[i]};
+}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::decode_into(ValueID* buffer, const size_t begin, const size_t end) const {
+  DebugAssert(begin <= end && end <= _values.size(), "FixedSizeAttributeVector: range out of bounds");
+  const auto* values = _values.data();
+  for (auto i = begin; i < end; ++i) {
+    *buffer++ = ValueID{values[i]};
+  }
+}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _values.size(), "FixedSizeAttributeVector: position out of range");
+  DebugAssert(value_id <= std::numeric_limits<uintX_t>::max(), "FixedSizeAttributeVector: value id is too wide");
+  _values[i] = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::size() const {
+  return _values.size();
+}
+
+template <typename uintX_t>
+AttributeVectorWidth FixedSizeAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::estimate_memory_usage() const {
+  return sizeof(uintX_t) * _values.size();
+}
+
+template <typename uintX_t>
+const pmr_vector<uintX_t>& FixedSizeAttributeVector<uintX_t>::values() const {
+  return _values;
+}
+
+template class FixedSizeAttributeVector<uint8_t>;
+template class FixedSizeAttributeVector<uint16_t>;
+template class FixedSizeAttributeVector<uint32_t>;
+
+}  // namespace opossum
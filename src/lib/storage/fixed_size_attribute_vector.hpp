@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FixedSizeAttributeVector stores each value id in an unsigned integer of a fixed width (uint8_t, uint16_t, or
+// uint32_t). The smallest width that can hold all value ids of a segment should be used.
+template <typename uintX_t>
+class FixedSizeAttributeVector : public BaseAttributeVector {
+ public:
+  // creates an attribute vector holding `size` value ids, all initialized to zero
+  explicit FixedSizeAttributeVector(const size_t size,
+                                    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  ValueID get(const size_t i) const final;
+
+  void decode_into(ValueID* buffer, const size_t begin, const size_t end) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the underlying values, e.g., for tight loops in operators
+  const pmr_vector<uintX_t>& values() const;
+
+ protected:
+  pmr_vector<uintX_t> _values;
+};
+
+}  // namespace opossum
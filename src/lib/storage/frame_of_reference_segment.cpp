@@ -0,0 +1,113 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "simd_bp128_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the minimum and the range of the values [begin, end), which is computed in unsigned arithmetic, as the
+// difference of two int64_t values may overflow
+template <typename T>
+std::pair<T, uint64_t> block_range(const pmr_vector<T>& values, const size_t begin, const size_t end) {
+  const auto [min_it, max_it] = std::minmax_element(values.cbegin() + begin, values.cbegin() + end);
+  return {*min_it, static_cast<uint64_t>(*max_it) - static_cast<uint64_t>(*min_it)};
+}
+
+}  // namespace
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_encodable(const ValueSegment<T>& value_segment) {
+  const auto& values = value_segment.values();
+  for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, values.size());
+    if (block_range(values, block_begin, block_end).second > std::numeric_limits<ValueID::base_type>::max()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _block_minima(std::make_shared<std::vector<T>>()) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "FrameOfReferenceSegment can only be created from a ValueSegment of the same type");
+  const auto& values = value_segment->values();
+
+  auto offsets = std::vector<ValueID>(values.size());
+  for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, values.size());
+    const auto [minimum, range] = block_range(values, block_begin, block_end);
+    Assert(range <= std::numeric_limits<ValueID::base_type>::max(),
+           "FrameOfReferenceSegment: value range of a block does not fit into 32 bits");
+
+    _block_minima->push_back(minimum);
+    for (auto i = block_begin; i < block_end; ++i) {
+      offsets[i] = ValueID{static_cast<ValueID::base_type>(static_cast<uint64_t>(values[i]) -
+                                                           static_cast<uint64_t>(minimum))};
+    }
+  }
+  _block_minima->shrink_to_fit();
+
+  // SimdBp128 chooses the bit width per 128 offsets, so that a single wide block does not widen all other blocks
+  _offsets = std::make_shared<SimdBp128AttributeVector>(offsets);
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(std::shared_ptr<std::vector<T>> block_minima,
+                                                    std::shared_ptr<BaseAttributeVector> offsets)
+    : _block_minima(std::move(block_minima)), _offsets(std::move(offsets)) {
+  Assert(_block_minima->size() == (_offsets->size() + BLOCK_SIZE - 1) / BLOCK_SIZE,
+         "FrameOfReferenceSegment: expected one minimum per block");
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "FrameOfReferenceSegment: chunk_offset out of range");
+  const auto minimum = (*_block_minima)[chunk_offset / BLOCK_SIZE];
+  return static_cast<T>(static_cast<uint64_t>(minimum) + _offsets->get(chunk_offset));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant& val) {
+  Fail("FrameOfReferenceSegment is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size());
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _block_minima->size() * sizeof(T) + _offsets->estimate_memory_usage();
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
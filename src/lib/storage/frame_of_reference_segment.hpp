@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is an immutable segment type for integral values. The segment is split into blocks of
+// BLOCK_SIZE rows. For each block, the minimum is stored, and each value is stored as its offset to the minimum of its
+// block. The offsets are stored in a SimdBp128AttributeVector, which packs every 128 offsets with the width needed for
+// the largest of them. This works well for values with a high cardinality but narrow local ranges, e.g., ids or
+// timestamps.
+// The offsets are unsigned 32-bit values, i.e., the range of values within a block must not exceed 2^32 - 1. Use
+// is_encodable to check this, encode_segment falls back to dictionary encoding otherwise.
+template <typename T>
+class ValueSegment;
+
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_integral_v<T>, "FrameOfReferenceSegment only supports integral types");
+
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  // returns whether the value range of each block of the ValueSegment fits into the offsets
+  static bool is_encodable(const ValueSegment<T>& value_segment);
+
+  // creates a FrameOfReferenceSegment from a ValueSegment of the same type
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from the block minima and offsets as returned by block_minima() and offsets(), e.g., when
+  // reading a table file
+  FrameOfReferenceSegment(std::shared_ptr<std::vector<T>> block_minima, std::shared_ptr<BaseAttributeVector> offsets);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position
+  T get(const ChunkOffset chunk_offset) const;
+
+  // frame of reference segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minima() const;
+
+  // returns the offset of each value to the minimum of its block
+  std::shared_ptr<const BaseAttributeVector> offsets() const;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _block_minima;
+  std::shared_ptr<BaseAttributeVector> _offsets;
+};
+
+}  // namespace opossum
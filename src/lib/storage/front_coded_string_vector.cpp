@@ -0,0 +1,156 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// lengths are stored as LEB128 variable-length integers, so that most of them take a single byte
+void write_length(std::vector<char>& data, size_t length) {
+  while (length >= 0x80) {
+    data.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  data.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& position) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+FrontCodedStringVector::FrontCodedStringVector(const std::vector<std::string>& values, const size_t block_size)
+    : _size(values.size()), _block_size(block_size) {
+  Assert(block_size > 0, "FrontCodedStringVector: block size must not be zero");
+  DebugAssert(std::is_sorted(values.cbegin(), values.cend()), "FrontCodedStringVector: values have to be sorted");
+
+  _block_offsets.reserve((_size + block_size - 1) / block_size);
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = values[index];
+    if (index % block_size == 0) {
+      Assert(_data.size() <= std::numeric_limits<uint32_t>::max(), "FrontCodedStringVector: strings exceed 4 GB");
+      _block_offsets.push_back(static_cast<uint32_t>(_data.size()));
+      write_length(_data, value.size());
+      _data.insert(_data.end(), value.cbegin(), value.cend());
+      continue;
+    }
+
+    const auto& previous = values[index - 1];
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(previous.cbegin(), previous.cbegin() + std::min(previous.size(), value.size()), value.cbegin())
+            .first -
+        previous.cbegin());
+    write_length(_data, prefix_length);
+    write_length(_data, value.size() - prefix_length);
+    _data.insert(_data.end(), value.cbegin() + prefix_length, value.cend());
+  }
+  _data.shrink_to_fit();
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const size_t size, const size_t block_size, std::vector<char> data,
+                                               std::vector<uint32_t> block_offsets)
+    : _size(size), _block_size(block_size), _data(std::move(data)), _block_offsets(std::move(block_offsets)) {
+  Assert(block_size > 0, "FrontCodedStringVector: block size must not be zero");
+  Assert(_block_offsets.size() == (size + block_size - 1) / block_size,
+         "FrontCodedStringVector: expected one offset per block");
+}
+
+std::string_view FrontCodedStringVector::_block_head(const size_t block_index) const {
+  const auto* position = _data.data() + _block_offsets[block_index];
+  const auto length = read_length(position);
+  return std::string_view{position, length};
+}
+
+template <typename Functor>
+void FrontCodedStringVector::_decode_block(const size_t block_index, const Functor& functor) const {
+  const auto* position = _data.data() + _block_offsets[block_index];
+  const auto head_length = read_length(position);
+  auto value = std::string{position, head_length};
+  position += head_length;
+
+  const auto block_begin = block_index * _block_size;
+  const auto block_end = std::min(block_begin + _block_size, _size);
+  for (auto index = block_begin; index < block_end; ++index) {
+    if (index != block_begin) {
+      const auto prefix_length = read_length(position);
+      const auto suffix_length = read_length(position);
+      value.resize(prefix_length);
+      value.append(position, suffix_length);
+      position += suffix_length;
+    }
+    if (functor(index, value)) return;
+  }
+}
+
+std::string FrontCodedStringVector::operator[](const size_t index) const {
+  DebugAssert(index < _size, "FrontCodedStringVector: index out of range");
+  auto result = std::string{};
+  _decode_block(index / _block_size, [&](const size_t decoded_index, const std::string& value) {
+    if (decoded_index != index) return false;
+    result = value;
+    return true;
+  });
+  return result;
+}
+
+template <typename Predicate>
+size_t FrontCodedStringVector::_partition_point(const Predicate& is_below) const {
+  // count the blocks whose head is below the bound - the bound is either in the last of these blocks or it is the head
+  // of the next block
+  auto blocks_below = size_t{0};
+  auto upper = _block_offsets.size();
+  while (blocks_below < upper) {
+    const auto middle = blocks_below + (upper - blocks_below) / 2;
+    if (is_below(_block_head(middle))) {
+      blocks_below = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  if (blocks_below == 0) return 0;
+
+  auto result = std::min(blocks_below * _block_size, _size);
+  _decode_block(blocks_below - 1, [&](const size_t index, const std::string& value) {
+    if (is_below(value)) return false;
+    result = index;
+    return true;
+  });
+  return result;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry < value; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry <= value; });
+}
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+size_t FrontCodedStringVector::block_size() const { return _block_size; }
+
+const std::vector<char>& FrontCodedStringVector::data() const { return _data; }
+
+const std::vector<uint32_t>& FrontCodedStringVector::block_offsets() const { return _block_offsets; }
+
+size_t FrontCodedStringVector::estimate_memory_usage() const {
+  return _data.size() * sizeof(char) + _block_offsets.size() * sizeof(uint32_t);
+}
+
+}  // namespace opossum
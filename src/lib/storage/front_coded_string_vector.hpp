@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// FrontCodedStringVector is an immutable, prefix-compressed vector of sorted strings. The strings are grouped into
+// blocks of block_size entries. The first string of each block (its head) is stored completely, every following string
+// only stores the length of the prefix it shares with its predecessor and the remaining suffix. Sorted strings with
+// long common prefixes, e.g., URLs or paths, shrink considerably.
+//
+// Accessing a string requires decoding its block up to that string, so strings are returned by value. lower_bound()
+// and upper_bound() binary-search the block heads and decode at most one block.
+class FrontCodedStringVector {
+ public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = size_t{16};
+
+  // the values have to be sorted
+  explicit FrontCodedStringVector(const std::vector<std::string>& values, const size_t block_size = DEFAULT_BLOCK_SIZE);
+
+  // takes over the encoded blocks of `size` strings as returned by data() and block_offsets(), e.g., when reading a
+  // table file
+  FrontCodedStringVector(const size_t size, const size_t block_size, std::vector<char> data,
+                         std::vector<uint32_t> block_offsets);
+
+  std::string operator[](const size_t index) const;
+
+  // returns the index of the first string >= value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the index of the first string > value, or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  size_t size() const;
+  size_t block_size() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+  // return the encoded blocks and the offset of each block in them
+  const std::vector<char>& data() const;
+  const std::vector<uint32_t>& block_offsets() const;
+
+ protected:
+  // returns the head of the given block without decoding it
+  std::string_view _block_head(const size_t block_index) const;
+
+  // calls functor(index, string) for the strings of a block in order until it returns true
+  template <typename Functor>
+  void _decode_block(const size_t block_index, const Functor& functor) const;
+
+  // returns the index of the first string for which is_below returns false, given that is_below is true for a prefix
+  // of the strings only
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& is_below) const;
+
+  const size_t _size;
+  const size_t _block_size;
+
+  // all blocks, with lengths stored as variable-length integers
+  std::vector<char> _data;
+  std::vector<uint32_t> _block_offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_id_groups.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : _indexed_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(indexed_segment)) {
+  Assert(_indexed_segment, "AdaptiveRadixTreeIndex requires a DictionarySegment");
+
+  auto groups = group_by_value_id(*_indexed_segment);
+  const auto& value_start_offsets = groups.value_start_offsets;
+  _positions = std::move(groups.positions);
+
+  auto leaf_entries = std::vector<LeafEntry>{};
+  leaf_entries.reserve(_indexed_segment->unique_values_count());
+  for (auto value_id = ValueID{0}; value_id < _indexed_segment->unique_values_count(); ++value_id) {
+    leaf_entries.push_back({to_art_key(value_id), _positions.cbegin() + value_start_offsets[value_id],
+                            _positions.cbegin() + value_start_offsets[value_id + 1]});
+  }
+  if (!leaf_entries.empty()) _root = _build(leaf_entries.cbegin(), leaf_entries.cend(), 0);
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build(const std::vector<LeafEntry>::const_iterator begin,
+                                                        const std::vector<LeafEntry>::const_iterator end,
+                                                        uint8_t depth) {
+  if (std::next(begin) == end) return std::make_unique<ARTLeaf>(begin->key, begin->begin, begin->end);
+
+  // as the entries are sorted, the first byte in which the first and the last key differ is the first byte in which
+  // any of the keys differ. The bytes before are stored as the prefix of the node.
+  const auto& first_key = begin->key;
+  const auto& last_key = std::prev(end)->key;
+  while (first_key[depth] == last_key[depth]) ++depth;
+
+  auto children = ARTInnerNode::Children{};
+  for (auto child_begin = begin; child_begin != end;) {
+    const auto key_byte = child_begin->key[depth];
+    const auto child_end =
+        std::find_if(child_begin, end, [&](const auto& entry) { return entry.key[depth] != key_byte; });
+    children.emplace_back(key_byte, _build(child_begin, child_end, static_cast<uint8_t>(depth + 1)));
+    child_begin = child_end;
+  }
+
+  if (children.size() <= 4) return std::make_unique<ARTNode4>(first_key, depth, std::move(children));
+  if (children.size() <= 16) return std::make_unique<ARTNode16>(first_key, depth, std::move(children));
+  if (children.size() <= 48) return std::make_unique<ARTNode48>(first_key, depth, std::move(children));
+  return std::make_unique<ARTNode256>(first_key, depth, std::move(children));
+}
+
+size_t AdaptiveRadixTreeIndex::estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * _positions.size() + (_root ? _root->estimate_memory_usage() : 0);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "AdaptiveRadixTreeIndex only indexes a single segment");
+  const auto value_id = _indexed_segment->lower_bound(values[0]);
+  if (value_id == INVALID_VALUE_ID) return _positions.cend();
+  return _root->lower_bound(to_art_key(value_id));
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "AdaptiveRadixTreeIndex only indexes a single segment");
+  const auto value_id = _indexed_segment->upper_bound(values[0]);
+  if (value_id == INVALID_VALUE_ID) return _positions.cend();
+  return _root->lower_bound(to_art_key(value_id));
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _positions.cbegin(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _positions.cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "base_index.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+// The AdaptiveRadixTreeIndex works on a single DictionarySegment. Like the GroupKeyIndex, it holds the offsets of all
+// rows sorted by value id. The bounds of a value are the bounds of its value id in an adaptive radix tree (Leis et al.,
+// ICDE 2013), whose big-endian keys are binary-comparable. Upper bounds are found as the lower bound of the next value
+// id. The tree uses node sizes of 4, 16, 48, and 256 children depending on the fanout, expands leaves lazily, and
+// compresses paths, so that a lookup visits at most four nodes and the tree stays small for sparse and dense key sets.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& indexed_segment);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // a value id and the range of its rows in _positions
+  struct LeafEntry {
+    ARTKey key;
+    Iterator begin;
+    Iterator end;
+  };
+
+  // builds the subtree of the leaf entries [begin, end), whose keys are equal before depth
+  static std::unique_ptr<ARTNode> _build(std::vector<LeafEntry>::const_iterator begin,
+                                         std::vector<LeafEntry>::const_iterator end, uint8_t depth);
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const final;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+
+  // chunk offsets of all rows, sorted by value id
+  std::vector<ChunkOffset> _positions;
+
+  // nullptr for empty segments
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTKey to_art_key(const ValueID value_id) {
+  auto key = ARTKey{};
+  for (auto byte_index = size_t{0}; byte_index < key.size(); ++byte_index) {
+    key[byte_index] = static_cast<uint8_t>(value_id >> (8 * (key.size() - 1 - byte_index)));
+  }
+  return key;
+}
+
+ARTNode::ARTNode(const Iterator begin, const Iterator end) : _begin(begin), _end(end) {}
+
+ARTNode::Iterator ARTNode::begin() const { return _begin; }
+
+ARTNode::Iterator ARTNode::end() const { return _end; }
+
+ARTLeaf::ARTLeaf(const ARTKey& key, const Iterator begin, const Iterator end) : ARTNode(begin, end), _key(key) {}
+
+ARTLeaf::Iterator ARTLeaf::lower_bound(const ARTKey& key) const { return _key >= key ? _begin : _end; }
+
+size_t ARTLeaf::estimate_memory_usage() const { return sizeof(ARTLeaf); }
+
+ARTInnerNode::ARTInnerNode(const ARTKey& prefix, const uint8_t depth, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _prefix(prefix), _depth(depth) {}
+
+ARTInnerNode::Iterator ARTInnerNode::lower_bound(const ARTKey& key) const {
+  // if the key leaves the subtree within the common prefix, it lies before or after all of its keys
+  const auto prefix_comparison = std::memcmp(key.data(), _prefix.data(), _depth);
+  if (prefix_comparison < 0) return _begin;
+  if (prefix_comparison > 0) return _end;
+
+  const auto [child, child_key_byte] = _first_child_from(key[_depth]);
+  if (!child) return _end;
+  if (child_key_byte != key[_depth]) return child->begin();
+  return child->lower_bound(key);
+}
+
+template <size_t Capacity>
+ARTSortedNode<Capacity>::ARTSortedNode(const ARTKey& prefix, const uint8_t depth, Children children)
+    : ARTInnerNode(prefix, depth, children.front().second->begin(), children.back().second->end()),
+      _child_count(static_cast<uint8_t>(children.size())) {
+  DebugAssert(children.size() <= Capacity, "ARTSortedNode: too many children");
+  for (auto child_index = size_t{0}; child_index < children.size(); ++child_index) {
+    _key_bytes[child_index] = children[child_index].first;
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+template <size_t Capacity>
+std::pair<const ARTNode*, uint8_t> ARTSortedNode<Capacity>::_first_child_from(const uint8_t key_byte) const {
+  const auto key_bytes_end = _key_bytes.cbegin() + _child_count;
+  const auto it = std::lower_bound(_key_bytes.cbegin(), key_bytes_end, key_byte);
+  if (it == key_bytes_end) return {nullptr, 0};
+  const auto child_index = std::distance(_key_bytes.cbegin(), it);
+  return {_children[child_index].get(), *it};
+}
+
+template <size_t Capacity>
+size_t ARTSortedNode<Capacity>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this);
+  for (auto child_index = size_t{0}; child_index < _child_count; ++child_index) {
+    memory_usage += _children[child_index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(const ARTKey& prefix, const uint8_t depth, Children children)
+    : ARTInnerNode(prefix, depth, children.front().second->begin(), children.back().second->end()) {
+  DebugAssert(children.size() <= _children.size(), "ARTNode48: too many children");
+  _slots.fill(EMPTY_SLOT);
+  for (auto child_index = size_t{0}; child_index < children.size(); ++child_index) {
+    _slots[children[child_index].first] = static_cast<uint8_t>(child_index);
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode48::_first_child_from(const uint8_t key_byte) const {
+  for (auto byte = size_t{key_byte}; byte < _slots.size(); ++byte) {
+    if (_slots[byte] != EMPTY_SLOT) return {_children[_slots[byte]].get(), static_cast<uint8_t>(byte)};
+  }
+  return {nullptr, 0};
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this);
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+ARTNode256::ARTNode256(const ARTKey& prefix, const uint8_t depth, Children children)
+    : ARTInnerNode(prefix, depth, children.front().second->begin(), children.back().second->end()) {
+  for (auto& [child_key_byte, child] : children) {
+    _children[child_key_byte] = std::move(child);
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode256::_first_child_from(const uint8_t key_byte) const {
+  for (auto byte = size_t{key_byte}; byte < _children.size(); ++byte) {
+    if (_children[byte]) return {_children[byte].get(), static_cast<uint8_t>(byte)};
+  }
+  return {nullptr, 0};
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this);
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+// Keys of the AdaptiveRadixTreeIndex are value ids in big-endian byte order, so that comparing them byte by byte
+// yields the order of the value ids (and thereby of the values).
+using ARTKey = std::array<uint8_t, sizeof(ValueID)>;
+
+ARTKey to_art_key(ValueID value_id);
+
+// A node of an adaptive radix tree. Each node covers the positions of all keys in its subtree, which form a
+// contiguous range [begin, end) of the positions of the index.
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  ARTNode(Iterator begin, Iterator end);
+  virtual ~ARTNode() = default;
+
+  // returns the first position of a key >= key
+  virtual Iterator lower_bound(const ARTKey& key) const = 0;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  // returns the calculated memory usage of the node and its children
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  const Iterator _begin;
+  const Iterator _end;
+};
+
+// Leaves store their complete key (lazy expansion), so that inner nodes are only created where keys differ.
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(const ARTKey& key, Iterator begin, Iterator end);
+
+  Iterator lower_bound(const ARTKey& key) const final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ARTKey _key;
+};
+
+// An inner node distinguishes its children by the key byte at its depth. All keys in its subtree share the bytes
+// before that depth. Instead of a chain of nodes with one child each, the node stores these bytes (path compression).
+class ARTInnerNode : public ARTNode {
+ public:
+  using Children = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
+  ARTInnerNode(const ARTKey& prefix, uint8_t depth, Iterator begin, Iterator end);
+
+  Iterator lower_bound(const ARTKey& key) const final;
+
+ protected:
+  // returns the child with the smallest key byte >= key_byte together with its key byte, or nullptr if none exists
+  virtual std::pair<const ARTNode*, uint8_t> _first_child_from(uint8_t key_byte) const = 0;
+
+  const ARTKey _prefix;
+  const uint8_t _depth;
+};
+
+// Node4 and Node16 store up to 4 or 16 key bytes in sorted order, next to the children
+template <size_t Capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode(const ARTKey& prefix, uint8_t depth, Children children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_from(uint8_t key_byte) const final;
+
+  uint8_t _child_count;
+  std::array<uint8_t, Capacity> _key_bytes{};
+  std::array<std::unique_ptr<ARTNode>, Capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node48 maps each key byte to a slot of one of up to 48 children
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48(const ARTKey& prefix, uint8_t depth, Children children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_from(uint8_t key_byte) const final;
+
+  static constexpr auto EMPTY_SLOT = uint8_t{255};
+  std::array<uint8_t, 256> _slots;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node256 holds one child pointer per key byte
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256(const ARTKey& prefix, uint8_t depth, Children children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_from(uint8_t key_byte) const final;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
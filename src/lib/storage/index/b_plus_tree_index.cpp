@@ -0,0 +1,248 @@
+#include "b_plus_tree_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+struct BPlusTreeIndex::Node {
+  virtual ~Node() = default;
+};
+
+// separators[i] is the smallest entry of the subtree of children[i + 1]
+struct BPlusTreeIndex::InnerNode : public Node {
+  std::vector<Entry> separators;
+  std::vector<std::unique_ptr<Node>> children;
+};
+
+// leaves are linked, so that range lookups do not have to go up the tree again
+struct BPlusTreeIndex::LeafNode : public Node {
+  std::vector<Entry> entries;
+  LeafNode* next = nullptr;
+};
+
+namespace {
+
+template <typename Entry>
+bool entry_less(const Entry& lhs, const Entry& rhs) {
+  if (lhs.key != rhs.key) return lhs.key < rhs.key;
+  return lhs.row_id < rhs.row_id;
+}
+
+// compares the first values.size() values of a key with values
+bool prefix_less(const BPlusTreeIndex::Key& key, const BPlusTreeIndex::Key& values) {
+  return std::lexicographical_compare(key.cbegin(), key.cbegin() + values.size(), values.cbegin(), values.cend());
+}
+
+bool prefix_equals(const BPlusTreeIndex::Key& key, const BPlusTreeIndex::Key& values) {
+  return std::equal(values.cbegin(), values.cend(), key.cbegin());
+}
+
+}  // namespace
+
+BPlusTreeIndex::BPlusTreeIndex(const Table& table, const std::vector<ColumnID>& column_ids) : _column_ids(column_ids) {
+  Assert(!column_ids.empty(), "BPlusTreeIndex: no columns given");
+  for (const auto column_id : column_ids) {
+    Assert(column_id < table.column_count(), "BPlusTreeIndex: column_id out of range");
+    _column_types.push_back(table.column_type(column_id));
+  }
+
+  auto entries = std::vector<Entry>{};
+  entries.reserve(table.row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      auto key = Key{};
+      key.reserve(column_ids.size());
+      for (const auto column_id : column_ids) key.push_back((*chunk.get_segment(column_id))[chunk_offset]);
+      entries.push_back({std::move(key), RowID{chunk_id, chunk_offset}});
+    }
+  }
+  std::sort(entries.begin(), entries.end(), entry_less<Entry>);
+  _size = entries.size();
+
+  // bulk loading: fill the leaves from the sorted entries, then build the inner levels bottom-up. Each level is a list
+  // of nodes together with the smallest entry of their subtree.
+  auto level = std::vector<std::pair<std::unique_ptr<Node>, const Entry*>>{};
+  LeafNode* previous_leaf = nullptr;
+  for (auto begin = size_t{0}; begin < entries.size(); begin += NODE_CAPACITY) {
+    auto leaf = std::make_unique<LeafNode>();
+    const auto end = std::min(begin + NODE_CAPACITY, entries.size());
+    leaf->entries.assign(std::make_move_iterator(entries.begin() + begin),
+                         std::make_move_iterator(entries.begin() + end));
+    if (previous_leaf) previous_leaf->next = leaf.get();
+    previous_leaf = leaf.get();
+    const auto* first_entry = &leaf->entries.front();
+    level.emplace_back(std::move(leaf), first_entry);
+  }
+
+  if (level.empty()) {
+    _root = std::make_unique<LeafNode>();
+    return;
+  }
+
+  while (level.size() > 1) {
+    auto parent_level = std::vector<std::pair<std::unique_ptr<Node>, const Entry*>>{};
+    for (auto begin = size_t{0}; begin < level.size(); begin += NODE_CAPACITY) {
+      auto inner_node = std::make_unique<InnerNode>();
+      const auto end = std::min(begin + NODE_CAPACITY, level.size());
+      for (auto child_index = begin; child_index < end; ++child_index) {
+        if (child_index != begin) inner_node->separators.push_back(*level[child_index].second);
+        inner_node->children.push_back(std::move(level[child_index].first));
+      }
+      parent_level.emplace_back(std::move(inner_node), level[begin].second);
+    }
+    level = std::move(parent_level);
+    ++_height;
+  }
+  _root = std::move(level.front().first);
+}
+
+BPlusTreeIndex::~BPlusTreeIndex() = default;
+
+const std::vector<ColumnID>& BPlusTreeIndex::column_ids() const { return _column_ids; }
+
+size_t BPlusTreeIndex::size() const { return _size; }
+
+size_t BPlusTreeIndex::height() const { return _height; }
+
+void BPlusTreeIndex::insert(const std::vector<AllTypeVariant>& row_values, const RowID row_id) {
+  auto key = Key{};
+  key.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    DebugAssert(column_id < row_values.size(), "BPlusTreeIndex: row has too few values");
+    key.push_back(row_values[column_id]);
+  }
+
+  auto split = _insert(*_root, 0, Entry{_normalize(key), row_id});
+  if (split) {
+    auto new_root = std::make_unique<InnerNode>();
+    new_root->separators.push_back(std::move(split->separator));
+    new_root->children.push_back(std::move(_root));
+    new_root->children.push_back(std::move(split->node));
+    _root = std::move(new_root);
+    ++_height;
+  }
+  ++_size;
+}
+
+std::optional<BPlusTreeIndex::Split> BPlusTreeIndex::_insert(Node& node, const size_t level, Entry entry) {
+  if (level == _height - 1) {
+    auto& leaf = static_cast<LeafNode&>(node);
+    const auto position = std::upper_bound(leaf.entries.begin(), leaf.entries.end(), entry, entry_less<Entry>);
+    leaf.entries.insert(position, std::move(entry));
+    if (leaf.entries.size() <= NODE_CAPACITY) return std::nullopt;
+
+    auto sibling = std::make_unique<LeafNode>();
+    const auto middle = leaf.entries.begin() + leaf.entries.size() / 2;
+    sibling->entries.assign(std::make_move_iterator(middle), std::make_move_iterator(leaf.entries.end()));
+    leaf.entries.erase(middle, leaf.entries.end());
+    sibling->next = leaf.next;
+    leaf.next = sibling.get();
+    auto separator = sibling->entries.front();
+    return Split{std::move(separator), std::move(sibling)};
+  }
+
+  auto& inner_node = static_cast<InnerNode&>(node);
+  const auto child_index = static_cast<size_t>(
+      std::upper_bound(inner_node.separators.cbegin(), inner_node.separators.cend(), entry, entry_less<Entry>) -
+      inner_node.separators.cbegin());
+  auto child_split = _insert(*inner_node.children[child_index], level + 1, std::move(entry));
+  if (!child_split) return std::nullopt;
+
+  inner_node.separators.insert(inner_node.separators.begin() + child_index, std::move(child_split->separator));
+  inner_node.children.insert(inner_node.children.begin() + child_index + 1, std::move(child_split->node));
+  if (inner_node.children.size() <= NODE_CAPACITY) return std::nullopt;
+
+  // the left node keeps the first half of the children, the separator between both halves moves up to the parent
+  auto sibling = std::make_unique<InnerNode>();
+  const auto middle = inner_node.children.size() / 2;
+  auto separator = std::move(inner_node.separators[middle - 1]);
+  sibling->separators.assign(std::make_move_iterator(inner_node.separators.begin() + middle),
+                             std::make_move_iterator(inner_node.separators.end()));
+  inner_node.separators.erase(inner_node.separators.begin() + middle - 1, inner_node.separators.end());
+  sibling->children.assign(std::make_move_iterator(inner_node.children.begin() + middle),
+                           std::make_move_iterator(inner_node.children.end()));
+  inner_node.children.erase(inner_node.children.begin() + middle, inner_node.children.end());
+  return Split{std::move(separator), std::move(sibling)};
+}
+
+std::shared_ptr<PosList> BPlusTreeIndex::equals(const Key& values) const {
+  const auto normalized_values = _normalize(values);
+  auto pos_list = std::make_shared<PosList>();
+  _scan_from(normalized_values, [&](const Entry& entry) {
+    if (!prefix_equals(entry.key, normalized_values)) return false;
+    pos_list->push_back(entry.row_id);
+    return true;
+  });
+  return pos_list;
+}
+
+std::shared_ptr<PosList> BPlusTreeIndex::range(const Key& lower_values, const Key& upper_values) const {
+  Assert(lower_values.size() == upper_values.size(), "BPlusTreeIndex: bounds of different length");
+  const auto normalized_upper_values = _normalize(upper_values);
+  auto pos_list = std::make_shared<PosList>();
+  _scan_from(_normalize(lower_values), [&](const Entry& entry) {
+    if (!prefix_less(entry.key, normalized_upper_values)) return false;
+    pos_list->push_back(entry.row_id);
+    return true;
+  });
+  return pos_list;
+}
+
+BPlusTreeIndex::Key BPlusTreeIndex::_normalize(const Key& values) const {
+  Assert(values.size() <= _column_ids.size(), "BPlusTreeIndex: more values than indexed columns");
+  auto normalized_values = Key{};
+  normalized_values.reserve(values.size());
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    resolve_data_type(_column_types[value_index], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      normalized_values.emplace_back(type_cast<Type>(values[value_index]));
+    });
+  }
+  return normalized_values;
+}
+
+const BPlusTreeIndex::LeafNode& BPlusTreeIndex::_find_leaf(const Key& values) const {
+  const auto* node = _root.get();
+  for (auto level = size_t{0}; level < _height - 1; ++level) {
+    const auto& inner_node = static_cast<const InnerNode&>(*node);
+    // skip all children whose entries are smaller than a separator with a smaller key prefix. If the first matching
+    // entry is itself a separator, the search ends at the end of the leaf before it and continues in the next leaf.
+    const auto child_index = std::lower_bound(inner_node.separators.cbegin(), inner_node.separators.cend(), values,
+                                              [](const Entry& separator, const Key& search_values) {
+                                                return prefix_less(separator.key, search_values);
+                                              }) -
+                             inner_node.separators.cbegin();
+    node = inner_node.children[child_index].get();
+  }
+  return static_cast<const LeafNode&>(*node);
+}
+
+template <typename Functor>
+void BPlusTreeIndex::_scan_from(const Key& lower_values, const Functor& functor) const {
+  const auto* leaf = &_find_leaf(lower_values);
+  auto entry_it = std::lower_bound(
+      leaf->entries.cbegin(), leaf->entries.cend(), lower_values,
+      [](const Entry& entry, const Key& search_values) { return prefix_less(entry.key, search_values); });
+
+  while (leaf) {
+    for (; entry_it != leaf->entries.cend(); ++entry_it) {
+      if (!functor(*entry_it)) return;
+    }
+    leaf = leaf->next;
+    if (leaf) entry_it = leaf->entries.cbegin();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A B+-tree on one or more columns of a table. In contrast to the per-chunk indexes (see BaseIndex), it maps keys to
+// RowIDs across all chunks, so that a lookup is a single descent instead of one probe per chunk. The results are
+// PosLists that can directly be wrapped in ReferenceSegments.
+//
+// The index is created by Table::create_index and maintained by Table::append. Keys are compared lexicographically,
+// lookups may specify a prefix of the indexed columns. Entries with equal keys are ordered by RowID, so the RowIDs of
+// a key are returned in the order of the rows.
+class BPlusTreeIndex : private Noncopyable {
+ public:
+  using Key = std::vector<AllTypeVariant>;
+
+  // maximum number of entries per leaf and of children per inner node
+  static constexpr auto NODE_CAPACITY = size_t{64};
+
+  // bulk-loads the index with all rows of the table
+  BPlusTreeIndex(const Table& table, const std::vector<ColumnID>& column_ids);
+  ~BPlusTreeIndex();
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  // inserts a row, given as a list of values of all columns of the table
+  void insert(const std::vector<AllTypeVariant>& row_values, RowID row_id);
+
+  // returns the RowIDs of all rows whose key starts with values
+  std::shared_ptr<PosList> equals(const Key& values) const;
+
+  // returns the RowIDs of all rows whose key prefix (of the length of the bounds) lies in [lower_values, upper_values)
+  std::shared_ptr<PosList> range(const Key& lower_values, const Key& upper_values) const;
+
+  // returns the number of indexed rows
+  size_t size() const;
+
+  // returns the number of levels, including the leaves
+  size_t height() const;
+
+ protected:
+  struct Entry {
+    Key key;
+    RowID row_id;
+  };
+  struct Node;
+  struct InnerNode;
+  struct LeafNode;
+
+  // the new right sibling of a split node and the smallest entry of its subtree
+  struct Split {
+    Entry separator;
+    std::unique_ptr<Node> node;
+  };
+
+  // converts the values to the data types of the indexed columns, so that, e.g., an int and a long compare as equal
+  Key _normalize(const Key& values) const;
+
+  // returns the leaf that contains the first entry whose key prefix is not less than values
+  const LeafNode& _find_leaf(const Key& values) const;
+
+  // calls functor with the RowIDs of all entries starting with the first one whose key prefix is not less than
+  // lower_values, until the functor returns false
+  template <typename Functor>
+  void _scan_from(const Key& lower_values, const Functor& functor) const;
+
+  // inserts an entry into the subtree of a node on the given level (0 is the root), returns the new right sibling if
+  // the node had to be split
+  std::optional<Split> _insert(Node& node, size_t level, Entry entry);
+
+  std::vector<ColumnID> _column_ids;
+  std::vector<std::string> _column_types;
+  std::unique_ptr<Node> _root;
+  size_t _height = 1;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "base_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  return _get_indexed_segments() == segments;
+}
+
+bool BaseIndex::indexes_only(const std::vector<std::shared_ptr<BaseSegment>>& segments) const {
+  const auto indexed_segments = _get_indexed_segments();
+  return std::all_of(indexed_segments.cbegin(), indexed_segments.cend(), [&](const auto& indexed_segment) {
+    return std::find(segments.cbegin(), segments.cend(), indexed_segment) != segments.cend();
+  });
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _get_indexed_segments().size(), "BaseIndex: more values than indexed segments");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _get_indexed_segments().size(), "BaseIndex: more values than indexed segments");
+  return _upper_bound(values);
+}
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> BaseIndex::equals(const std::vector<AllTypeVariant>& values) const {
+  return {lower_bound(values), upper_bound(values)};
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+}  // namespace opossum
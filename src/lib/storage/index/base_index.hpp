@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// BaseIndex is the abstract super class for all secondary indexes of a chunk, e.g., GroupKeyIndex. An index maps
+// (possibly composite) keys to the offsets of the rows holding them. All indexes return their offsets as a range
+// [begin, end) over a position list that is sorted by key, so that a range of keys is a range of positions.
+//
+// Indexes are built on immutable segments and are not updated. The indexed values are passed as one AllTypeVariant
+// per indexed segment.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  BaseIndex() = default;
+  virtual ~BaseIndex() = default;
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns whether the index is built on exactly the given segments, in the same order
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
+
+  // returns whether each indexed segment is one of the given segments, e.g., of a chunk whose segments were replaced
+  bool indexes_only(const std::vector<std::shared_ptr<BaseSegment>>& segments) const;
+
+  // returns an iterator to the position of the first row with a key >= values
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the position of the first row with a key > values
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the range of positions of all rows with a key == values
+  std::pair<Iterator, Iterator> equals(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the range of all indexed positions, sorted by key
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const = 0;
+};
+
+}  // namespace opossum
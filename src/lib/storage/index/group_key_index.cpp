@@ -0,0 +1,50 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_id_groups.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::shared_ptr<const BaseSegment>& indexed_segment)
+    : _indexed_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(indexed_segment)) {
+  Assert(_indexed_segment, "GroupKeyIndex requires a DictionarySegment");
+
+  auto groups = group_by_value_id(*_indexed_segment);
+  _value_start_offsets = std::move(groups.value_start_offsets);
+  _positions = std::move(groups.positions);
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * (_value_start_offsets.size() + _positions.size());
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "GroupKeyIndex only indexes a single segment");
+  return _get_positions_iterator(_indexed_segment->lower_bound(values[0]));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "GroupKeyIndex only indexes a single segment");
+  return _get_positions_iterator(_indexed_segment->upper_bound(values[0]));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cbegin() const { return _positions.cbegin(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cend() const { return _positions.cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_get_positions_iterator(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _positions.cend();
+  return _positions.cbegin() + _value_start_offsets[value_id];
+}
+
+}  // namespace opossum
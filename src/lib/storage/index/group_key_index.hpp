@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+// The GroupKeyIndex works on a single DictionarySegment. It holds the offsets of all rows, grouped (and thereby
+// sorted) by value id, and for each value id the position of its first row within these offsets. As the dictionary is
+// sorted, the rows of all values in a range of value ids lie next to each other, too.
+//
+// Example: attribute vector [2, 0, 1, 0] -> positions [1, 3, 2, 0], value start offsets [0, 2, 3, 4]
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::shared_ptr<const BaseSegment>& indexed_segment);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const final;
+
+  // returns the position of the first row of the given value id, or the end for INVALID_VALUE_ID
+  Iterator _get_positions_iterator(ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+
+  // value_id -> offset into _positions, has one more entry than the dictionary
+  std::vector<ChunkOffset> _value_start_offsets;
+
+  // chunk offsets of all rows, grouped by value id
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
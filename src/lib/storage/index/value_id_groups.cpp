@@ -0,0 +1,34 @@
+#include "value_id_groups.hpp"
+
+#include <vector>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_segment.hpp"
+
+namespace opossum {
+
+ValueIdGroups group_by_value_id(const BaseDictionarySegment& segment) {
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto row_count = attribute_vector.size();
+  auto groups = ValueIdGroups{};
+
+  // count the rows per value id, compute the start of each group by a prefix sum, and then place each row at the next
+  // free position of its group
+  auto& value_start_offsets = groups.value_start_offsets;
+  value_start_offsets.resize(segment.unique_values_count() + 1);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    ++value_start_offsets[attribute_vector.get(chunk_offset) + 1];
+  }
+  for (auto value_id = size_t{1}; value_id < value_start_offsets.size(); ++value_id) {
+    value_start_offsets[value_id] += value_start_offsets[value_id - 1];
+  }
+
+  auto next_positions = value_start_offsets;
+  groups.positions.resize(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    groups.positions[next_positions[attribute_vector.get(chunk_offset)]++] = chunk_offset;
+  }
+  return groups;
+}
+
+}  // namespace opossum
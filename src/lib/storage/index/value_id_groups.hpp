@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+// The chunk offsets of a DictionarySegment grouped by their value ids, the basis of GroupKeyIndex and
+// AdaptiveRadixTreeIndex
+struct ValueIdGroups {
+  // value_id -> offset into positions, has one more entry than the dictionary
+  std::vector<ChunkOffset> value_start_offsets;
+
+  // the chunk offsets sorted by value id, and ascending within each value id
+  std::vector<ChunkOffset> positions;
+};
+
+// groups the chunk offsets of the segment by a counting sort over its value ids
+ValueIdGroups group_by_value_id(const BaseDictionarySegment& segment);
+
+}  // namespace opossum
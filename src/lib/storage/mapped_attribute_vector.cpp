@@ -0,0 +1,54 @@
+#include "mapped_attribute_vector.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+MappedAttributeVector<uintX_t>::MappedAttributeVector(std::shared_ptr<const MappedFile> file, const uintX_t* values,
+                                                      const size_t size)
+    : _file(std::move(file)), _values(values), _size(size) {}
+
+template <typename uintX_t>
+ValueID MappedAttributeVector<uintX_t>::get(const size_t i) const {
+  DebugAssert(i < _size, "MappedAttributeVector: position out of range");
+  return ValueID{_values[i]};
+}
+
+template <typename uintX_t>
+void MappedAttributeVector<uintX_t>::decode_into(ValueID* buffer, const size_t begin, const size_t end) const {
+  DebugAssert(begin <= end && end <= _size, "MappedAttributeVector: range out of bounds");
+  for (auto i = begin; i < end; ++i) {
+    *buffer++ = ValueID{_values[i]};
+  }
+}
+
+template <typename uintX_t>
+void MappedAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  Fail("MappedAttributeVector is immutable");
+}
+
+template <typename uintX_t>
+size_t MappedAttributeVector<uintX_t>::size() const {
+  return _size;
+}
+
+template <typename uintX_t>
+AttributeVectorWidth MappedAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+size_t MappedAttributeVector<uintX_t>::estimate_memory_usage() const {
+  return sizeof(uintX_t) * _size;
+}
+
+template class MappedAttributeVector<uint8_t>;
+template class MappedAttributeVector<uint16_t>;
+template class MappedAttributeVector<uint32_t>;
+
+}  // namespace opossum
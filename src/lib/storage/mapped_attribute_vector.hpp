@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class MappedFile;
+
+// MappedAttributeVector reads value ids of a fixed width (uint8_t, uint16_t, or uint32_t) directly from a memory-mapped
+// file, see mmap_table. It keeps the file mapped and cannot be modified.
+template <typename uintX_t>
+class MappedAttributeVector : public BaseAttributeVector {
+ public:
+  // `values` has to point to `size` value ids inside `file`
+  MappedAttributeVector(std::shared_ptr<const MappedFile> file, const uintX_t* values, const size_t size);
+
+  ValueID get(const size_t i) const final;
+
+  void decode_into(ValueID* buffer, const size_t begin, const size_t end) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  // the mapped bytes, which the operating system loads on demand
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::shared_ptr<const MappedFile> _file;
+  const uintX_t* const _values;
+  const size_t _size;
+};
+
+}  // namespace opossum
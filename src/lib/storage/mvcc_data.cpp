@@ -0,0 +1,27 @@
+#include "mvcc_data.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MvccData::MvccData(const ChunkOffset capacity)
+    : begin_cids(capacity), end_cids(capacity), tids(capacity), published(capacity) {
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < capacity; ++chunk_offset) {
+    begin_cids[chunk_offset].store(MAX_COMMIT_ID, std::memory_order_relaxed);
+    end_cids[chunk_offset].store(MAX_COMMIT_ID, std::memory_order_relaxed);
+    tids[chunk_offset].store(INVALID_TRANSACTION_ID, std::memory_order_relaxed);
+    published[chunk_offset].store(false, std::memory_order_relaxed);
+  }
+}
+
+bool MvccData::is_visible(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                          const CommitID snapshot_commit_id) const {
+  DebugAssert(transaction_id != INVALID_TRANSACTION_ID, "MvccData: rows are not locked by the invalid transaction");
+  const auto begin_cid = begin_cids[chunk_offset].load();
+  const auto end_cid = end_cids[chunk_offset].load();
+  // the own uncommitted inserts are visible, unless they are deleted again, the own uncommitted deletes are not
+  if (tids[chunk_offset].load() == transaction_id) return begin_cid == MAX_COMMIT_ID && end_cid == MAX_COMMIT_ID;
+  return begin_cid <= snapshot_commit_id && end_cid > snapshot_commit_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The MVCC columns of a chunk. A row is visible to a transaction if its snapshot includes the commit that inserted
+// the row (begin commit id), but not the one that deleted it (end commit id). Until it commits, the transaction that
+// inserts or deletes a row holds its row lock (transaction id). Uncommitted rows are visible to their own transaction
+// only.
+//
+// The columns have a fixed capacity, so that readers can access them without locks while rows are appended. Writers
+// reserve rows by incrementing reserved and mark them as published after their values and MVCC entries are written
+// (see Chunk::reserve_rows). size is the length of the published prefix of the rows, readers ignore the rows beyond.
+struct MvccData : private Noncopyable {
+  explicit MvccData(const ChunkOffset capacity);
+
+  // returns whether the row is visible to the transaction with the given id and snapshot
+  bool is_visible(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                  const CommitID snapshot_commit_id) const;
+
+  std::vector<std::atomic<CommitID>> begin_cids;
+  std::vector<std::atomic<CommitID>> end_cids;
+  std::vector<std::atomic<TransactionID>> tids;
+
+  // whether the writer of a row is done with it, see Chunk::publish_rows
+  std::vector<std::atomic<bool>> published;
+
+  // the number of rows up to the first one that is not published yet
+  std::atomic<ChunkOffset> size{0};
+
+  // the number of rows reserved by writers, which is at most the capacity
+  std::atomic<ChunkOffset> reserved{0};
+};
+
+}  // namespace opossum
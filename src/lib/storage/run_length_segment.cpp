@@ -0,0 +1,88 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _values(std::make_shared<std::vector<T>>()), _end_positions(std::make_shared<std::vector<ChunkOffset>>()) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "RunLengthSegment can only be created from a ValueSegment of the same type");
+  const auto& values = value_segment->values();
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    if (!_values->empty() && _values->back() == values[chunk_offset]) {
+      _end_positions->back() = chunk_offset;
+      continue;
+    }
+    _values->push_back(values[chunk_offset]);
+    _end_positions->push_back(chunk_offset);
+  }
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::shared_ptr<std::vector<T>> values,
+                                      std::shared_ptr<std::vector<ChunkOffset>> end_positions)
+    : _values(std::move(values)), _end_positions(std::move(end_positions)) {
+  Assert(_values->size() == _end_positions->size(), "RunLengthSegment: expected one end position per run");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  return get(chunk_offset);
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "RunLengthSegment: chunk_offset out of range");
+  // the run containing chunk_offset is the first one that ends at or after it
+  const auto run = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+  return (*_values)[std::distance(_end_positions->cbegin(), run)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant& val) {
+  Fail("RunLengthSegment is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  if (_end_positions->empty()) return 0;
+  return _end_positions->back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return _values->size() * sizeof(T) + _end_positions->size() * sizeof(ChunkOffset);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
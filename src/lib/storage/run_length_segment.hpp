@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is an immutable segment type that stores runs of equal values only once. For each run, it holds
+// the value and the chunk offset of the last row of the run. Sorted or clustered segments with long runs shrink
+// substantially and can be scanned by evaluating a predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // creates a RunLengthSegment from a ValueSegment of the same type
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from the runs as returned by values() and end_positions(), e.g., when reading a table file
+  RunLengthSegment(std::shared_ptr<std::vector<T>> values, std::shared_ptr<std::vector<ChunkOffset>> end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position
+  T get(const ChunkOffset chunk_offset) const;
+
+  // run length segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the chunk offset of the last row of each run, which is also the position of the run's value in values()
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // returns the number of runs
+  size_t run_count() const;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
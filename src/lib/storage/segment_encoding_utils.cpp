@@ -0,0 +1,64 @@
+#include "segment_encoding_utils.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseSegment> encode_segment(const EncodingType encoding_type, const std::string& data_type,
+                                            const std::shared_ptr<BaseSegment>& value_segment,
+                                            std::pmr::memory_resource* memory_resource) {
+  return encode_segment(SegmentEncodingSpec{encoding_type}, data_type, value_segment, memory_resource);
+}
+
+std::shared_ptr<BaseSegment> encode_segment(const SegmentEncodingSpec& spec, const std::string& data_type,
+                                            const std::shared_ptr<BaseSegment>& value_segment,
+                                            std::pmr::memory_resource* memory_resource) {
+  auto encoded_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    switch (spec.encoding_type) {
+      case EncodingType::Dictionary:
+        encoded_segment =
+            std::make_shared<DictionarySegment<Type>>(value_segment, spec.attribute_vector_type, memory_resource);
+        return;
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<Type>>(value_segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_integral_v<Type>) {
+          // blocks whose values span more than 32 bits, e.g., of nanosecond timestamps, are dictionary-encoded instead
+          const auto typed_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(value_segment);
+          if (typed_segment && !FrameOfReferenceSegment<Type>::is_encodable(*typed_segment)) {
+            encoded_segment = std::make_shared<DictionarySegment<Type>>(value_segment, spec.attribute_vector_type,
+                                                                        memory_resource);
+          } else {
+            encoded_segment = std::make_shared<FrameOfReferenceSegment<Type>>(value_segment);
+          }
+        } else {
+          Fail("FrameOfReference encoding is only supported for integral types, not for " + data_type);
+        }
+        return;
+      case EncodingType::FrontCodedDictionary:
+        if constexpr (std::is_same_v<Type, std::string>) {
+          encoded_segment = std::make_shared<FrontCodedDictionarySegment>(value_segment, spec.attribute_vector_type);
+        } else {
+          Fail("FrontCodedDictionary encoding is only supported for strings, not for " + data_type);
+        }
+        return;
+    }
+  });
+  Assert(encoded_segment, "Could not encode segment of type " + data_type);
+  return encoded_segment;
+}
+
+}  // namespace opossum
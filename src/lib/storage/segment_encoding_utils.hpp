@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+#include "encoding_advisor.hpp"
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Compresses a ValueSegment of the given data type (e.g., "int") using the given encoding. Throws if the encoding does
+// not support the data type. FrameOfReference falls back to dictionary encoding if the values of a block span more
+// than 32 bits. Dictionary encodings allocate from memory_resource.
+std::shared_ptr<BaseSegment> encode_segment(
+    const EncodingType encoding_type, const std::string& data_type, const std::shared_ptr<BaseSegment>& value_segment,
+    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+// same as above, but also selects the attribute vector type of dictionary encodings
+std::shared_ptr<BaseSegment> encode_segment(
+    const SegmentEncodingSpec& spec, const std::string& data_type, const std::shared_ptr<BaseSegment>& value_segment,
+    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+}  // namespace opossum
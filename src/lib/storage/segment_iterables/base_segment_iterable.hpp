@@ -0,0 +1,74 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A value of a segment together with its position. Value is the type in which the segment provides its values
+// cheapest, e.g., const T& for ValueSegments or std::string_view for string dictionaries.
+template <typename Value>
+class SegmentPosition {
+ public:
+  SegmentPosition(Value value, const ChunkOffset chunk_offset) : _value(value), _chunk_offset(chunk_offset) {}
+
+  Value value() const { return _value; }
+
+  // the offset of the value in the iterated segment, i.e., the index into the PosList of a ReferenceSegment
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ private:
+  Value _value;
+  ChunkOffset _chunk_offset;
+};
+
+// Iterators of the segment iterables create their SegmentPositions when they are dereferenced. Subclasses implement
+// increment(), equal(), and dereference() and declare boost::iterator_core_access a friend.
+template <typename Derived, typename Value>
+using BaseSegmentIterator =
+    boost::iterator_facade<Derived, SegmentPosition<Value>, boost::forward_traversal_tag, SegmentPosition<Value>>;
+
+// Iterators over dictionary-encoded values additionally provide value_id(), chunk_offset(), and dictionary_segment(),
+// which do not look up the value of the current position. Operators use them to compare value ids instead of values.
+template <typename Iterator, typename = void>
+struct HasValueIds : std::false_type {};
+
+template <typename Iterator>
+struct HasValueIds<Iterator, std::void_t<decltype(std::declval<const Iterator&>().value_id())>> : std::true_type {};
+
+template <typename Iterator>
+constexpr auto has_value_ids_v = HasValueIds<Iterator>::value;
+
+// Segment iterables replace AllTypeVariant operator[] of the segments in the loops of operators. They pass typed
+// iterators to a functor, which is compiled once per iterator type, so that neither a virtual call nor a variant is
+// involved per row:
+//
+//   ValueSegmentIterable<int32_t>{segment}.with_iterators([&](auto it, const auto end) {
+//     for (; it != end; ++it) sum += it->value();
+//   });
+//
+// The iterables are light-weight and only valid as long as their segment. Subclasses implement
+// _on_with_iterators(functor), which may call the functor several times for consecutive ranges of the segment.
+template <typename Derived>
+class SegmentIterable {
+ public:
+  // calls functor(begin, end) for the ranges of the segment, in order
+  template <typename Functor>
+  void with_iterators(const Functor& functor) const {
+    static_cast<const Derived&>(*this)._on_with_iterators(functor);
+  }
+
+  // calls functor(position) for each position of the segment, in order
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    with_iterators([&](auto it, const auto end) {
+      for (; it != end; ++it) functor(*it);
+    });
+  }
+};
+
+}  // namespace opossum
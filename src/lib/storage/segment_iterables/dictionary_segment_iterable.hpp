@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "base_segment_iterable.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Calls functor with a callable that returns the value id at a given offset of the attribute vector. The common
+// FixedSizeAttributeVectors are read directly, all others through the virtual get().
+template <typename Functor>
+void with_value_id_getter(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  const auto read_directly = [&](auto uint_type) {
+    using UintType = decltype(uint_type);
+    const auto fixed_size_vector = dynamic_cast<const FixedSizeAttributeVector<UintType>*>(&attribute_vector);
+    if (!fixed_size_vector) return false;
+    const auto* value_ids = fixed_size_vector->values().data();
+    functor([value_ids](const size_t i) { return ValueID{value_ids[i]}; });
+    return true;
+  };
+
+  if (read_directly(uint8_t{}) || read_directly(uint16_t{}) || read_directly(uint32_t{})) return;
+  functor([&attribute_vector](const size_t i) { return attribute_vector.get(i); });
+}
+
+// Iterates the values of a DictionarySegment as its ValueReference, e.g., as std::string_view for contiguous string
+// dictionaries. The iterators decode the value ids block-wise, i.e., with one call to the attribute vector per block,
+// and also provide the value ids (see HasValueIds).
+template <typename T, typename Dictionary = DefaultDictionary<T>>
+class DictionarySegmentIterable : public SegmentIterable<DictionarySegmentIterable<T, Dictionary>> {
+ public:
+  using Segment = DictionarySegment<T, Dictionary>;
+  using Value = typename Segment::ValueReference;
+
+  explicit DictionarySegmentIterable(const Segment& segment) : _segment(segment) {}
+
+  class Iterator : public BaseSegmentIterator<Iterator, Value> {
+   public:
+    // the block size of SimdBp128AttributeVector, so that its blocks are decoded in place
+    static constexpr auto BLOCK_SIZE = ChunkOffset{128};
+
+    Iterator(const Segment& segment, const BaseAttributeVector& attribute_vector, const ChunkOffset chunk_offset)
+        : _segment(&segment), _attribute_vector(&attribute_vector), _chunk_offset(chunk_offset) {}
+
+    ValueID value_id() const {
+      if (_chunk_offset < _block_begin || _chunk_offset >= _block_end) {
+        _block_begin = _chunk_offset;
+        _block_end = std::min(_chunk_offset + BLOCK_SIZE, static_cast<ChunkOffset>(_attribute_vector->size()));
+        _attribute_vector->decode_into(_value_ids.data(), _block_begin, _block_end);
+      }
+      return _value_ids[_chunk_offset - _block_begin];
+    }
+
+    ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+    const Segment& dictionary_segment() const { return *_segment; }
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentPosition<Value> dereference() const { return {_segment->value_by_value_id(value_id()), _chunk_offset}; }
+
+    const Segment* _segment;
+    const BaseAttributeVector* _attribute_vector;
+    ChunkOffset _chunk_offset;
+
+    // the decoded value ids of the rows [_block_begin, _block_end)
+    mutable std::array<ValueID, BLOCK_SIZE> _value_ids{};
+    mutable ChunkOffset _block_begin = 0;
+    mutable ChunkOffset _block_end = 0;
+  };
+
+ protected:
+  friend class SegmentIterable<DictionarySegmentIterable<T, Dictionary>>;
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& attribute_vector = *_segment.attribute_vector();
+    functor(Iterator{_segment, attribute_vector, ChunkOffset{0}},
+            Iterator{_segment, attribute_vector, static_cast<ChunkOffset>(attribute_vector.size())});
+  }
+
+  const Segment& _segment;
+};
+
+}  // namespace opossum
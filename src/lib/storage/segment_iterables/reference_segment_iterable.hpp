@@ -0,0 +1,149 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "base_segment_iterable.hpp"
+#include "dictionary_segment_iterable.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Returns the value at a chunk offset of a dictionary segment. Unlike a lambda, it also exposes the segment and the
+// value ids, so that PointAccessIterator can provide them (see HasValueIds).
+template <typename Segment, typename ValueIdGetter>
+class DictionaryValueGetter {
+ public:
+  DictionaryValueGetter(const Segment& segment, const ValueIdGetter& get_value_id)
+      : _segment(&segment), _get_value_id(get_value_id) {}
+
+  decltype(auto) operator()(const ChunkOffset chunk_offset) const {
+    return _segment->value_by_value_id(_get_value_id(chunk_offset));
+  }
+
+  ValueID value_id(const ChunkOffset chunk_offset) const { return _get_value_id(chunk_offset); }
+
+  const Segment& segment() const { return *_segment; }
+
+ private:
+  const Segment* _segment;
+  ValueIdGetter _get_value_id;
+};
+
+// Iterates the positions [index, end) of a PosList. The values are read by get_value(chunk_offset) from a referenced
+// segment, the positions are the indices into the PosList.
+template <typename Value, typename Getter>
+class PointAccessIterator : public BaseSegmentIterator<PointAccessIterator<Value, Getter>, Value> {
+ public:
+  PointAccessIterator(const Getter& get_value, const PosList& pos_list, const size_t index)
+      : _get_value(&get_value), _pos_list(&pos_list), _index(index) {}
+
+  // only available if the referenced segment is a dictionary segment
+  template <typename DictionaryGetter = Getter>
+  auto value_id() const -> decltype(std::declval<const DictionaryGetter&>().value_id(ChunkOffset{})) {
+    return _get_value->value_id((*_pos_list)[_index].chunk_offset);
+  }
+
+  template <typename DictionaryGetter = Getter>
+  auto dictionary_segment() const -> decltype(std::declval<const DictionaryGetter&>().segment()) {
+    return _get_value->segment();
+  }
+
+  ChunkOffset chunk_offset() const { return static_cast<ChunkOffset>(_index); }
+
+ private:
+  friend class boost::iterator_core_access;
+
+  void increment() { ++_index; }
+
+  bool equal(const PointAccessIterator& other) const { return _index == other._index; }
+
+  SegmentPosition<Value> dereference() const {
+    return {(*_get_value)((*_pos_list)[_index].chunk_offset), static_cast<ChunkOffset>(_index)};
+  }
+
+  const Getter* _get_value;
+  const PosList* _pos_list;
+  size_t _index;
+};
+
+// Iterates the values of a ReferenceSegment of type T. Consecutive positions usually reference the same chunk, so the
+// type of the referenced segment is resolved once per such range, and the functor is called once per range with
+// iterators for that segment type. The values are of the type in which the referenced segment provides them. Ranges
+// referencing a dictionary segment also provide the value ids (see HasValueIds).
+template <typename T>
+class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable<T>> {
+ public:
+  explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment(segment) {}
+
+ protected:
+  friend class SegmentIterable<ReferenceSegmentIterable<T>>;
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& pos_list = *_segment.pos_list();
+    const auto& referenced_table = *_segment.referenced_table();
+
+    auto range_begin = size_t{0};
+    while (range_begin < pos_list.size()) {
+      const auto chunk_id = pos_list[range_begin].chunk_id;
+      auto range_end = range_begin + 1;
+      while (range_end < pos_list.size() && pos_list[range_end].chunk_id == chunk_id) ++range_end;
+
+      // keeps the referenced segment loaded while the functor runs
+      const auto referenced_segment =
+          referenced_table.get_chunk(chunk_id).get_segment(_segment.referenced_column_id());
+      _with_value_getter(*referenced_segment, [&](const auto& get_value) {
+        using Getter = std::decay_t<decltype(get_value)>;
+        using Value = decltype(get_value(ChunkOffset{}));
+        using Iterator = PointAccessIterator<Value, Getter>;
+        functor(Iterator{get_value, pos_list, range_begin}, Iterator{get_value, pos_list, range_end});
+      });
+      range_begin = range_end;
+    }
+  }
+
+  // calls functor with a callable that returns the value at a chunk offset of the referenced segment
+  template <typename Functor>
+  static void _with_value_getter(const BaseSegment& segment, const Functor& functor) {
+    const auto with_dictionary_getter = [&](const auto& dictionary_segment) {
+      with_value_id_getter(*dictionary_segment.attribute_vector(), [&](const auto& get_value_id) {
+        using Segment = std::decay_t<decltype(dictionary_segment)>;
+        functor(DictionaryValueGetter<Segment, std::decay_t<decltype(get_value_id)>>{dictionary_segment, get_value_id});
+      });
+    };
+
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+      const auto* values = value_segment->values().data();
+      functor([values](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; });
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      with_dictionary_getter(*dictionary_segment);
+    } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+      functor([run_length_segment](const ChunkOffset chunk_offset) { return run_length_segment->get(chunk_offset); });
+    } else if constexpr (std::is_same_v<T, std::string>) {
+      const auto front_coded_segment = dynamic_cast<const FrontCodedDictionarySegment*>(&segment);
+      Assert(front_coded_segment, "ReferenceSegmentIterable: unsupported referenced segment type");
+      with_dictionary_getter(*front_coded_segment);
+    } else if constexpr (std::is_integral_v<T>) {
+      const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment);
+      Assert(frame_of_reference_segment, "ReferenceSegmentIterable: unsupported referenced segment type");
+      functor([frame_of_reference_segment](const ChunkOffset chunk_offset) {
+        return frame_of_reference_segment->get(chunk_offset);
+      });
+    } else {
+      Fail("ReferenceSegmentIterable: unsupported referenced segment type");
+    }
+  }
+
+  const ReferenceSegment& _segment;
+};
+
+}  // namespace opossum
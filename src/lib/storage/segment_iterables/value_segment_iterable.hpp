@@ -0,0 +1,51 @@
+#pragma once
+
+#include "base_segment_iterable.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Iterates the values of a ValueSegment as const T&. The values of chunks with MVCC are preallocated, so readers pass
+// the number of published rows of the chunk as size.
+template <typename T>
+class ValueSegmentIterable : public SegmentIterable<ValueSegmentIterable<T>> {
+ public:
+  explicit ValueSegmentIterable(const ValueSegment<T>& segment) : ValueSegmentIterable(segment, segment.size()) {}
+
+  ValueSegmentIterable(const ValueSegment<T>& segment, const ChunkOffset size) : _segment(segment), _size(size) {
+    DebugAssert(size <= segment.size(), "ValueSegmentIterable: size exceeds the segment");
+  }
+
+  class Iterator : public BaseSegmentIterator<Iterator, const T&> {
+   public:
+    Iterator(const T* values, const ChunkOffset chunk_offset) : _values(values), _chunk_offset(chunk_offset) {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentPosition<const T&> dereference() const { return {_values[_chunk_offset], _chunk_offset}; }
+
+    const T* _values;
+    ChunkOffset _chunk_offset;
+  };
+
+ protected:
+  friend class SegmentIterable<ValueSegmentIterable<T>>;
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto* values = _segment.values().data();
+    functor(Iterator{values, ChunkOffset{0}}, Iterator{values, _size});
+  }
+
+  const ValueSegment<T>& _segment;
+  const ChunkOffset _size;
+};
+
+}  // namespace opossum
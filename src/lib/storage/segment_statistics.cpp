@@ -0,0 +1,156 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "bloom_filter.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "value_segment.hpp"
+
+#include "utils/hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A HyperLogLog sketch with 2^10 registers, which estimates the number of distinct values with a standard error of
+// about 3% in one kilobyte.
+class DistinctCountEstimator {
+ public:
+  template <typename T>
+  void add(const T& value) {
+    const auto hash = mixed_hash(value);
+    const auto register_index = hash >> (64 - INDEX_BITS);
+    const auto remaining_bits = (hash << INDEX_BITS) | (uint64_t{1} << (INDEX_BITS - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+    _registers[register_index] = std::max(_registers[register_index], rank);
+  }
+
+  size_t estimate() const {
+    constexpr auto REGISTER_COUNT = double{1 << INDEX_BITS};
+    constexpr auto ALPHA = 0.7213 / (1.0 + 1.079 / REGISTER_COUNT);
+
+    auto sum = 0.0;
+    auto empty_registers = size_t{0};
+    for (const auto rank : _registers) {
+      sum += std::ldexp(1.0, -rank);
+      if (rank == 0) ++empty_registers;
+    }
+    auto estimate = ALPHA * REGISTER_COUNT * REGISTER_COUNT / sum;
+
+    // linear counting is more precise for small cardinalities
+    if (estimate <= 2.5 * REGISTER_COUNT && empty_registers > 0) {
+      estimate = REGISTER_COUNT * std::log(REGISTER_COUNT / static_cast<double>(empty_registers));
+    }
+    return static_cast<size_t>(std::llround(estimate));
+  }
+
+ private:
+  static constexpr auto INDEX_BITS = 10;
+  std::array<uint8_t, 1 << INDEX_BITS> _registers{};
+};
+
+// Only integral values can be dense, i.e., occupy a large share of [min, max]. Then, min and max alone prune nearly as
+// well as a Bloom filter would, so building one only costs time and memory.
+constexpr auto MIN_VALUES_PER_DISTINCT_VALUE = 4.0;
+
+template <typename T>
+bool is_sparse(const T& min, const T& max, const size_t distinct_count) {
+  if constexpr (std::is_integral_v<T>) {
+    // compute the range in double, as the difference of two int64_t values may overflow
+    return static_cast<double>(max) - static_cast<double>(min) + 1.0 >=
+           MIN_VALUES_PER_DISTINCT_VALUE * static_cast<double>(distinct_count);
+  } else {
+    return true;
+  }
+}
+
+// Creates a Bloom filter from a function returning the value at a given offset. It is sized using the distinct count,
+// which is known only after a first pass over the values.
+template <typename Getter>
+std::shared_ptr<const BloomFilter> create_bloom_filter(const size_t size, const size_t distinct_count,
+                                                       const Getter& get_value) {
+  auto bloom_filter = std::make_shared<BloomFilter>(distinct_count);
+  for (auto offset = size_t{0}; offset < size; ++offset) {
+    bloom_filter->insert(mixed_hash(get_value(offset)));
+  }
+  return bloom_filter;
+}
+
+// Computes the statistics from a function returning the value at a given offset. A Bloom filter is only built for
+// sparse values.
+template <typename T, typename Getter>
+std::shared_ptr<const SegmentStatistics> create_statistics(const size_t size, const Getter& get_value) {
+  if (size == 0) return nullptr;
+
+  auto estimator = DistinctCountEstimator{};
+  T min = get_value(0);
+  T max = min;
+  for (auto offset = size_t{0}; offset < size; ++offset) {
+    const auto& value = get_value(offset);
+    if (value < min) min = value;
+    if (max < value) max = value;
+    estimator.add(value);
+  }
+  const auto distinct_count = estimator.estimate();
+  auto bloom_filter =
+      is_sparse(min, max, distinct_count) ? create_bloom_filter(size, distinct_count, get_value) : nullptr;
+  return std::make_shared<SegmentStatistics>(SegmentStatistics{min, max, distinct_count, std::move(bloom_filter)});
+}
+
+// Dictionary segments get no Bloom filter, as scans look up the search value in the sorted dictionary anyway and skip
+// the segment if it is missing
+template <typename Segment>
+std::shared_ptr<const SegmentStatistics> create_dictionary_statistics(const Segment& segment) {
+  const auto distinct_count = segment.unique_values_count();
+  if (distinct_count == 0) return nullptr;
+
+  using Type = std::decay_t<decltype(segment.get(0))>;
+  const auto get_value = [&](const size_t value_id) {
+    return Type{segment.value_by_value_id(ValueID{static_cast<ValueID::base_type>(value_id)})};
+  };
+  return std::make_shared<SegmentStatistics>(
+      SegmentStatistics{get_value(0), get_value(distinct_count - 1), distinct_count, nullptr});
+}
+
+}  // namespace
+
+std::shared_ptr<const SegmentStatistics> create_segment_statistics(const std::string& data_type,
+                                                                   const BaseSegment& segment) {
+  auto statistics = std::shared_ptr<const SegmentStatistics>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    if (const auto value_segment = dynamic_cast<const ValueSegment<Type>*>(&segment)) {
+      const auto& values = value_segment->values();
+      statistics = create_statistics<Type>(values.size(), [&](const size_t offset) { return values[offset]; });
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      statistics = create_dictionary_statistics(*dictionary_segment);
+    } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<Type>*>(&segment)) {
+      // the values of the runs contain each value of the segment
+      const auto& values = *run_length_segment->values();
+      statistics = create_statistics<Type>(values.size(), [&](const size_t offset) { return values[offset]; });
+    } else if constexpr (std::is_same_v<Type, std::string>) {
+      if (const auto front_coded_segment = dynamic_cast<const FrontCodedDictionarySegment*>(&segment)) {
+        statistics = create_dictionary_statistics(*front_coded_segment);
+      }
+    } else if constexpr (std::is_integral_v<Type>) {
+      if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<Type>*>(&segment)) {
+        statistics = create_statistics<Type>(frame_of_reference_segment->size(), [&](const size_t offset) {
+          return frame_of_reference_segment->get(static_cast<ChunkOffset>(offset));
+        });
+      }
+    }
+  });
+  return statistics;
+}
+
+}  // namespace opossum
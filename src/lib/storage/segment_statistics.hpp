@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class BloomFilter;
+
+// Pruning statistics (zone map) of a single segment. Operators use them to skip chunks that cannot contain any
+// matching rows, e.g., TableScan skips a chunk if the search value of an OpEquals scan lies outside of [min, max].
+struct SegmentStatistics {
+  AllTypeVariant min;
+  AllTypeVariant max;
+
+  // exact for dictionary-encoded segments, estimated using HyperLogLog otherwise
+  size_t distinct_count;
+
+  // Optional filter for OpEquals scans. In contrast to min and max, it also prunes segments of unclustered columns,
+  // e.g., of hashed ids, where almost every search value lies within [min, max]. Costs about ten bits per distinct
+  // value, so it is only built if the values are sparse within [min, max], i.e., for strings, floating-point values,
+  // and integers with a range of at least four times the distinct count. Dictionary segments have none, as scans find
+  // missing values in the dictionary.
+  std::shared_ptr<const BloomFilter> bloom_filter;
+};
+
+// Computes the statistics of a segment of the given data type. Returns nullptr for empty segments and segment types
+// without their own values, i.e., ReferenceSegments.
+std::shared_ptr<const SegmentStatistics> create_segment_statistics(const std::string& data_type,
+                                                                   const BaseSegment& segment);
+
+}  // namespace opossum
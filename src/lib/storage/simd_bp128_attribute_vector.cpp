@@ -0,0 +1,188 @@
+#include "simd_bp128_attribute_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "attribute_vector_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BITS_PER_WORD = uint32_t{32};
+constexpr auto BLOCK_SIZE = SimdBp128AttributeVector::BLOCK_SIZE;
+constexpr auto LANE_COUNT = SimdBp128AttributeVector::LANE_COUNT;
+constexpr auto VALUES_PER_LANE = BLOCK_SIZE / LANE_COUNT;
+
+// Packs the 128 (reference-adjusted) values of a block. The i-th value of lane l is values[i * 4 + l], its bits start
+// at bit i * bit_width of the lane, and the k-th word of lane l is stored at words[k * 4 + l].
+void pack_block(const uint32_t* values, const uint8_t bit_width, uint32_t* words) {
+  for (auto i = size_t{0}; i < VALUES_PER_LANE; ++i) {
+    const auto bit_position = i * bit_width;
+    const auto word = bit_position / BITS_PER_WORD;
+    const auto shift = bit_position % BITS_PER_WORD;
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      const auto value = values[i * LANE_COUNT + lane];
+      words[word * LANE_COUNT + lane] |= value << shift;
+      if (shift + bit_width > BITS_PER_WORD) {
+        words[(word + 1) * LANE_COUNT + lane] |= value >> (BITS_PER_WORD - shift);
+      }
+    }
+  }
+}
+
+void unpack_block(const uint32_t* words, const uint8_t bit_width, const uint32_t reference, ValueID* buffer) {
+  if (bit_width == 0) {
+    std::fill(buffer, buffer + BLOCK_SIZE, ValueID{reference});
+    return;
+  }
+
+  const auto mask = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+  for (auto i = size_t{0}; i < VALUES_PER_LANE; ++i) {
+    const auto bit_position = i * bit_width;
+    const auto word = bit_position / BITS_PER_WORD;
+    const auto shift = bit_position % BITS_PER_WORD;
+    const auto spans_words = shift + bit_width > BITS_PER_WORD;
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      auto value = words[word * LANE_COUNT + lane] >> shift;
+      if (spans_words) value |= words[(word + 1) * LANE_COUNT + lane] << (BITS_PER_WORD - shift);
+      buffer[i * LANE_COUNT + lane] = ValueID{(value & mask) + reference};
+    }
+  }
+}
+
+}  // namespace
+
+SimdBp128AttributeVector::SimdBp128AttributeVector(const std::vector<ValueID>& value_ids,
+                                                   std::pmr::memory_resource* memory_resource)
+    : _size(value_ids.size()),
+      _references(memory_resource),
+      _bit_widths(memory_resource),
+      _block_offsets(memory_resource),
+      _words(memory_resource) {
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _references.reserve(block_count);
+  _bit_widths.reserve(block_count);
+  _block_offsets.reserve(block_count);
+
+  auto max_value_id = ValueID::base_type{0};
+  auto block = std::array<uint32_t, BLOCK_SIZE>{};
+  for (auto block_begin = size_t{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    const auto [min_it, max_it] = std::minmax_element(value_ids.cbegin() + block_begin, value_ids.cbegin() + block_end);
+    const auto reference = ValueID::base_type{*min_it};
+    max_value_id = std::max(max_value_id, ValueID::base_type{*max_it});
+
+    // the last block is padded with the reference, i.e., zeros after subtracting it
+    block.fill(0);
+    for (auto i = block_begin; i < block_end; ++i) block[i - block_begin] = value_ids[i] - reference;
+
+    const auto range = static_cast<size_t>(*max_it - reference);
+    const auto bit_width = range == 0 ? uint8_t{0} : required_bit_width(range + 1);
+
+    _references.push_back(reference);
+    _bit_widths.push_back(bit_width);
+    _block_offsets.push_back(_words.size());
+
+    _words.resize(_words.size() + bit_width * LANE_COUNT);
+    if (bit_width > 0) pack_block(block.data(), bit_width, _words.data() + _block_offsets.back());
+  }
+
+  _width = static_cast<AttributeVectorWidth>(std::max(1, (required_bit_width(size_t{max_value_id} + 1) + 7) / 8));
+}
+
+SimdBp128AttributeVector::SimdBp128AttributeVector(const size_t size, const AttributeVectorWidth width,
+                                                   pmr_vector<ValueID::base_type> references,
+                                                   pmr_vector<uint8_t> bit_widths, pmr_vector<uint32_t> words)
+    : _size(size),
+      _width(width),
+      _references(std::move(references)),
+      _bit_widths(std::move(bit_widths)),
+      _block_offsets(_references.get_allocator()),
+      _words(std::move(words)) {
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  Assert(_references.size() == block_count && _bit_widths.size() == block_count,
+         "SimdBp128AttributeVector: number of blocks does not match the size");
+  _block_offsets.reserve(block_count);
+  auto word_count = size_t{0};
+  for (const auto bit_width : _bit_widths) {
+    _block_offsets.push_back(word_count);
+    word_count += bit_width * LANE_COUNT;
+  }
+  Assert(_words.size() == word_count, "SimdBp128AttributeVector: number of words does not match the bit widths");
+}
+
+ValueID SimdBp128AttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "SimdBp128AttributeVector: position out of range");
+  const auto block_index = i / BLOCK_SIZE;
+  const auto bit_width = _bit_widths[block_index];
+  if (bit_width == 0) return ValueID{_references[block_index]};
+
+  const auto index_in_block = i % BLOCK_SIZE;
+  const auto lane = index_in_block % LANE_COUNT;
+  const auto bit_position = (index_in_block / LANE_COUNT) * bit_width;
+  const auto word = bit_position / BITS_PER_WORD;
+  const auto shift = bit_position % BITS_PER_WORD;
+  const auto* words = _words.data() + _block_offsets[block_index];
+
+  auto value = words[word * LANE_COUNT + lane] >> shift;
+  if (shift + bit_width > BITS_PER_WORD) value |= words[(word + 1) * LANE_COUNT + lane] << (BITS_PER_WORD - shift);
+  const auto mask = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+  return ValueID{(value & mask) + _references[block_index]};
+}
+
+void SimdBp128AttributeVector::decode_block(const size_t block_index, ValueID* buffer) const {
+  DebugAssert((block_index + 1) * BLOCK_SIZE <= _size, "SimdBp128AttributeVector: block is not complete");
+  unpack_block(_words.data() + _block_offsets[block_index], _bit_widths[block_index], _references[block_index],
+               buffer);
+}
+
+void SimdBp128AttributeVector::decode_into(ValueID* buffer, const size_t begin, const size_t end) const {
+  DebugAssert(begin <= end && end <= _size, "SimdBp128AttributeVector: range out of bounds");
+  auto block_buffer = std::array<ValueID, BLOCK_SIZE>{};
+
+  auto position = begin;
+  while (position < end) {
+    const auto block_index = position / BLOCK_SIZE;
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, end);
+
+    if (position == block_begin && block_end == block_begin + BLOCK_SIZE) {
+      // whole blocks are decoded directly into the output
+      unpack_block(_words.data() + _block_offsets[block_index], _bit_widths[block_index], _references[block_index],
+                   buffer);
+    } else {
+      unpack_block(_words.data() + _block_offsets[block_index], _bit_widths[block_index], _references[block_index],
+                   block_buffer.data());
+      std::copy(block_buffer.cbegin() + (position - block_begin), block_buffer.cbegin() + (block_end - block_begin),
+                buffer);
+    }
+
+    buffer += block_end - position;
+    position = block_end;
+  }
+}
+
+void SimdBp128AttributeVector::set(const size_t i, const ValueID value_id) {
+  Fail("SimdBp128AttributeVector is immutable");
+}
+
+size_t SimdBp128AttributeVector::size() const { return _size; }
+
+AttributeVectorWidth SimdBp128AttributeVector::width() const { return _width; }
+
+const pmr_vector<ValueID::base_type>& SimdBp128AttributeVector::references() const { return _references; }
+
+const pmr_vector<uint8_t>& SimdBp128AttributeVector::bit_widths() const { return _bit_widths; }
+
+const pmr_vector<uint32_t>& SimdBp128AttributeVector::words() const { return _words; }
+
+size_t SimdBp128AttributeVector::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint32_t) + _references.size() * sizeof(ValueID::base_type) +
+         _bit_widths.size() * sizeof(uint8_t) + _block_offsets.size() * sizeof(size_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// SimdBp128AttributeVector compresses value ids in blocks of 128 using the SIMD-BP128 layout combined with a frame of
+// reference: each block stores its smallest value id as reference and packs the differences to it with the bit width
+// of the largest difference in that block. Within a block, the value ids are distributed round-robin over four 32-bit
+// lanes, which are packed "vertically" so that the same word and shift is used for all lanes at the same time. Thus,
+// the loops in decode_into() process four value ids per step and can be vectorized by the compiler.
+//
+// As the bit width is chosen per block, clustered or sorted value ids compress considerably better than with a
+// BitPackedAttributeVector. The vector is immutable, random access through get() is possible but slower than decoding
+// ranges through decode_into().
+class SimdBp128AttributeVector : public BaseAttributeVector {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{128};
+  static constexpr auto LANE_COUNT = size_t{4};
+
+  explicit SimdBp128AttributeVector(const std::vector<ValueID>& value_ids,
+                                    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // takes over the blocks of a vector with `size` value ids as returned by references(), bit_widths(), and words(),
+  // e.g., when reading a table file. width is the width of the widest value id in bytes.
+  SimdBp128AttributeVector(const size_t size, const AttributeVectorWidth width,
+                           pmr_vector<ValueID::base_type> references, pmr_vector<uint8_t> bit_widths,
+                           pmr_vector<uint32_t> words);
+
+  ValueID get(const size_t i) const final;
+
+  void decode_into(ValueID* buffer, const size_t begin, const size_t end) const final;
+
+  // decodes the block with the given index, which has to be complete, into buffer
+  void decode_block(const size_t block_index, ValueID* buffer) const;
+
+  // SimdBp128AttributeVectors are immutable
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  // returns the number of bytes needed to hold the widest value id
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // return the reference and the bit width of each block, and the packed blocks
+  const pmr_vector<ValueID::base_type>& references() const;
+  const pmr_vector<uint8_t>& bit_widths() const;
+  const pmr_vector<uint32_t>& words() const;
+
+ protected:
+  const size_t _size;
+  AttributeVectorWidth _width;
+
+  // per block: the reference (minimum) value id, the bit width, and the offset of its first word in _words
+  pmr_vector<ValueID::base_type> _references;
+  pmr_vector<uint8_t> _bit_widths;
+  pmr_vector<size_t> _block_offsets;
+
+  pmr_vector<uint32_t> _words;
+};
+
+}  // namespace opossum
@@ -1,47 +1,183 @@
 #include "storage_manager.hpp"
 
+#include <filesystem>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "utils/assert.hpp"
+#include "utils/table_file.hpp"
 
 namespace opossum {
 
 StorageManager& StorageManager::get() {
-  return *(new StorageManager());
-  // A really hacky fix to get the tests to run - replace this with your implementation
+  static auto storage_manager = StorageManager{};
+  return storage_manager;
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  // Implementation goes here
+  {
+    const auto lock = std::unique_lock{_tables_mutex};
+    Assert(!_tables.count(name), "StorageManager: a table named " + name + " already exists");
+    _tables.emplace(name, std::move(table));
+  }
+  enforce_memory_budget();
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  // Implementation goes here
+  // the table is destroyed after the lock is released, unless a query still uses it
+  auto table = std::shared_ptr<Table>{};
+  const auto lock = std::unique_lock{_tables_mutex};
+  const auto it = _tables.find(name);
+  Assert(it != _tables.cend(), "StorageManager: there is no table named " + name);
+  table = std::move(it->second);
+  _tables.erase(it);
+}
+
+void StorageManager::replace_table(const std::string& name, std::shared_ptr<Table> table) {
+  {
+    const auto lock = std::unique_lock{_tables_mutex};
+    const auto it = _tables.find(name);
+    Assert(it != _tables.cend(), "StorageManager: there is no table named " + name);
+    // the previous version is destroyed outside of the lock
+    std::swap(it->second, table);
+  }
+  table = nullptr;
+  enforce_memory_budget();
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  // Implementation goes here
-  return nullptr;
+  const auto lock = std::shared_lock{_tables_mutex};
+  const auto it = _tables.find(name);
+  Assert(it != _tables.cend(), "StorageManager: there is no table named " + name);
+  return it->second;
 }
 
 bool StorageManager::has_table(const std::string& name) const {
-  // Implementation goes here
-  return false;
+  const auto lock = std::shared_lock{_tables_mutex};
+  return _tables.count(name);
 }
 
 std::vector<std::string> StorageManager::table_names() const {
-  throw std::runtime_error("Implement StorageManager::table_names");
+  const auto lock = std::shared_lock{_tables_mutex};
+  auto table_names = std::vector<std::string>{};
+  table_names.reserve(_tables.size());
+  for (const auto& [name, table] : _tables) table_names.push_back(name);
+  return table_names;
 }
 
 void StorageManager::print(std::ostream& out) const {
-  // Implementation goes here
+  for (const auto& [name, table] : _table_snapshot()) {
+    out << "\"" << name << "\" (" << table->column_count() << " columns, " << table->row_count() << " rows, "
+        << table->chunk_count() << " chunks)" << std::endl;
+  }
 }
 
 void StorageManager::reset() {
-  // Implementation goes here;
+  const auto lock = std::scoped_lock{_mutex, _tables_mutex};
+  _tables.clear();
+  _memory_budget = std::numeric_limits<size_t>::max();
+  _spill_directory.clear();
+  _clock_hand = 0;
+}
+
+void StorageManager::set_memory_budget(const size_t memory_budget, const std::string& spill_directory) {
+  const auto lock = std::lock_guard{_mutex};
+  std::filesystem::create_directories(spill_directory);
+  _memory_budget = memory_budget;
+  _spill_directory = spill_directory;
+  _enforce_memory_budget();
+}
+
+void StorageManager::enforce_memory_budget() {
+  const auto lock = std::lock_guard{_mutex};
+  _enforce_memory_budget();
+}
+
+size_t StorageManager::memory_usage() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _memory_usage();
+}
+
+void StorageManager::_enforce_memory_budget() {
+  auto memory_usage = _memory_usage();
+  if (memory_usage <= _memory_budget) return;
+
+  // the clock hand is an index into the chunks of all tables in the order of their names
+  const auto tables = _table_snapshot();
+  auto chunks = std::vector<std::pair<Table*, ChunkID>>{};
+  for (const auto& [name, table] : tables) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      chunks.emplace_back(table.get(), chunk_id);
+    }
+  }
+
+  // In the first round, the hand clears the accessed flags of the chunks it passes, so that all chunks can be evicted
+  // in the second round.
+  for (auto step = size_t{0}; step < 2 * chunks.size() && memory_usage > _memory_budget; ++step) {
+    _clock_hand = (_clock_hand + 1) % chunks.size();
+    const auto& [table, chunk_id] = chunks[_clock_hand];
+    auto& chunk = table->get_chunk(chunk_id);
+    if (chunk.test_and_clear_accessed() || !chunk.is_evictable()) continue;
+
+    const auto chunk_memory_usage = chunk.memory_usage();
+    if (chunk_memory_usage > 0 && _evict_chunk(*table, chunk)) memory_usage -= chunk_memory_usage;
+  }
+}
+
+size_t StorageManager::_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& [name, table] : _table_snapshot()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      memory_usage += table->get_chunk(chunk_id).memory_usage();
+    }
+  }
+  return memory_usage;
+}
+
+bool StorageManager::_evict_chunk(const Table& table, Chunk& chunk) {
+  // segments that were loaded from a file before are not written again, as chunks with a loader are immutable
+  if (chunk.has_segment_loader()) return chunk.evict();
+
+  auto column_types = std::vector<std::string>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    column_types.push_back(table.column_type(column_id));
+  }
+
+  // the segments are only written once the chunk turned out to be neither pinned nor busy
+  return chunk.spill_and_evict([&](const std::vector<std::shared_ptr<BaseSegment>>& segments) {
+    auto load = std::function<std::shared_ptr<BaseSegment>(ColumnID)>{};
+
+    // Only chunks whose segments are restored as they are, i.e., with their encoding and memory usage, are evicted.
+    // Otherwise, paging the chunk back in could take more memory than evicting it freed.
+    for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+      if (!is_storable(*segments[column_id], column_types[column_id])) return load;
+    }
+
+    const auto file_name = _spill_directory + "/chunk_" + std::to_string(_spill_file_count++) + ".bin";
+    load = [this, load_segment = spill_segments(segments, column_types, file_name)](const ColumnID column_id) {
+      auto segment = load_segment(column_id);
+      _on_segment_loaded();
+      return segment;
+    };
+    return load;
+  });
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<Table>>> StorageManager::_table_snapshot() const {
+  const auto lock = std::shared_lock{_tables_mutex};
+  return {_tables.cbegin(), _tables.cend()};
+}
+
+void StorageManager::_on_segment_loaded() {
+  if (_enforcement_scheduled.exchange(true)) return;
+  _evictor.schedule([this] {
+    _enforcement_scheduled = false;
+    enforce_memory_budget();
+  });
 }
 
 }  // namespace opossum
@@ -1,18 +1,36 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <atomic>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/worker_pool.hpp"
 
 namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// It can limit the memory used by the segments of its tables (see set_memory_budget). If the budget is exceeded,
+// immutable chunks are evicted to a spill directory and paged back in when their segments are accessed again. The
+// chunks to evict are chosen by the clock algorithm: the clock hand passes over all chunks and evicts the first one
+// that was not accessed since the hand passed it last. Chunks with pinned segments, i.e., segments that are in use,
+// are skipped.
+//
+// Looking up tables only takes the catalog lock in shared mode, so that concurrent queries do not wait for each other.
+// Neither do they wait for evictions, which work on a snapshot of the catalog. Tables can be replaced atomically, in
+// which case running queries keep reading the previous version.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -23,6 +41,10 @@ class StorageManager : private Noncopyable {
   // removes the table from the storage manger
   void drop_table(const std::string& name);
 
+  // Replaces the table with the given name, e.g., by a reloaded version. Queries that retrieved the previous version
+  // keep it, later lookups return the new one.
+  void replace_table(const std::string& name, std::shared_ptr<Table> table);
+
   // returns the table instance with the given name
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
@@ -38,12 +60,50 @@ class StorageManager : private Noncopyable {
   // deletes the entire StorageManager and creates a new one, used especially in tests
   void reset();
 
+  // Sets the memory budget in bytes for the segments of all tables and evicts chunks until it is met. Evicted chunks
+  // are written to files in spill_directory, which is created if necessary. When evicted segments are paged back in,
+  // the budget is enforced again in the background.
+  void set_memory_budget(const size_t memory_budget, const std::string& spill_directory);
+
+  // evicts chunks that were not accessed recently until the memory usage fits the budget or no chunk can be evicted
+  void enforce_memory_budget();
+
+  // returns the estimated memory usage of the loaded segments of all tables
+  size_t memory_usage() const;
+
   StorageManager(StorageManager&&) = delete;
 
  protected:
   StorageManager() {}
   StorageManager& operator=(StorageManager&&) = default;
 
-  // Implementation goes here
+  // the implementations of the above methods, called with _mutex held
+  void _enforce_memory_budget();
+  size_t _memory_usage() const;
+  bool _evict_chunk(const Table& table, Chunk& chunk);
+
+  // returns the tables in the order of their names, which is the order in which the clock hand passes their chunks
+  std::vector<std::pair<std::string, std::shared_ptr<Table>>> _table_snapshot() const;
+
+  // called after an evicted segment was paged back in, schedules enforce_memory_budget if it is not already scheduled
+  void _on_segment_loaded();
+
+  std::map<std::string, std::shared_ptr<Table>> _tables;
+  // Protects _tables, lookups take it in shared mode. A copy-on-write map behind a std::atomic<std::shared_ptr> would
+  // not make lookups cheaper: the atomic is not lock-free in libstdc++, and every add_table would copy the map.
+  mutable std::shared_mutex _tables_mutex;
+
+  size_t _memory_budget = std::numeric_limits<size_t>::max();
+  std::string _spill_directory;
+  size_t _spill_file_count = 0;
+  size_t _clock_hand = 0;
+
+  // protects the memory budget and the clock hand, and serializes evictions. It is taken before _tables_mutex.
+  mutable std::mutex _mutex;
+
+  // Segments are paged back in by the readers while they hold the lock of the chunk. The budget is enforced by a
+  // separate thread, so that the readers neither wait for evictions nor deadlock with them.
+  std::atomic<bool> _enforcement_scheduled{false};
+  WorkerPool _evictor{1};
 };
 }  // namespace opossum
@@ -1,83 +1,527 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <limits>
 #include <memory>
-#include <numeric>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
+#include "index/b_plus_tree_index.hpp"
+#include "mvcc_data.hpp"
+#include "segment_encoding_utils.hpp"
+#include "segment_statistics.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/worker_pool.hpp"
 
 namespace opossum {
 
-Table::Table(const ChunkOffset target_chunk_size) {
-  // Implementation goes here
+namespace {
+
+std::vector<std::shared_ptr<const SegmentStatistics>> create_statistics(
+    const std::vector<std::string>& column_types, const std::vector<std::shared_ptr<BaseSegment>>& segments) {
+  auto statistics = std::vector<std::shared_ptr<const SegmentStatistics>>{};
+  statistics.reserve(segments.size());
+  for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    statistics.push_back(create_segment_statistics(column_types[column_id], *segments[column_id]));
+  }
+  return statistics;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> get_segments(const Chunk& chunk) {
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  segments.reserve(chunk.column_count());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    segments.push_back(chunk.get_segment(column_id));
+  }
+  return segments;
+}
+
+// Replaces the segments of a chunk by the ones returned by encode(column_id, segment). Readers keep seeing the previous
+// segments until all new ones are swapped in at once. The chunk is left untouched if encode returns all segments as
+// they are, or if its segments were replaced in the meantime, e.g., by a manual compression.
+template <typename Functor>
+void encode_chunk(Chunk& chunk, const std::vector<std::string>& column_types, const Functor& encode) {
+  const auto previous_segments = get_segments(chunk);
+  auto segments = previous_segments;
+  for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    segments[column_id] = encode(column_id, segments[column_id]);
+  }
+  if (segments == previous_segments) return;
+
+  auto statistics = create_statistics(column_types, segments);
+  chunk.replace_segments_if_unchanged(previous_segments, std::move(segments), std::move(statistics));
+}
+
+// The workers that encode the segments of compress_chunk(s) in parallel. They are separate from the background workers,
+// so that encode_chunks() never waits for jobs that are queued behind the job it runs in.
+WorkerPool& compression_workers() {
+  static auto worker_pool = WorkerPool{};
+  return worker_pool;
+}
+
+// Same as encode_chunk, but for several chunks, with encode(chunk_index, column_id, segment). Each segment is encoded
+// by its own job, so that both the columns of a chunk and the chunks themselves are compressed in parallel. The
+// segments of a chunk are still swapped in at once, each chunk independently of the others.
+template <typename Functor>
+void encode_chunks(const std::vector<std::shared_ptr<Chunk>>& chunks, const std::vector<std::string>& column_types,
+                   const Functor& encode) {
+  auto segments = std::vector<std::vector<std::shared_ptr<BaseSegment>>>{};
+  auto statistics = std::vector<std::vector<std::shared_ptr<const SegmentStatistics>>>{};
+  auto jobs = std::vector<std::future<void>>{};
+  for (const auto& chunk : chunks) {
+    // the preallocated ValueSegments of open chunks with MVCC hold rows that are not appended yet
+    Assert(chunk->is_finalized(), "Table: only finalized chunks can be compressed");
+    segments.push_back(get_segments(*chunk));
+    statistics.emplace_back(column_types.size());
+  }
+  for (auto chunk_index = size_t{0}; chunk_index < chunks.size(); ++chunk_index) {
+    for (auto column_id = ColumnID{0}; column_id < segments[chunk_index].size(); ++column_id) {
+      jobs.push_back(compression_workers().schedule([&, chunk_index, column_id] {
+        auto& segment = segments[chunk_index][column_id];
+        segment = encode(chunk_index, column_id, segment);
+        statistics[chunk_index][column_id] = create_segment_statistics(column_types[column_id], *segment);
+      }));
+    }
+  }
+
+  // all jobs have to finish before an error is rethrown, as they refer to the segments and statistics of this frame
+  for (const auto& job : jobs) job.wait();
+  for (auto& job : jobs) job.get();
+
+  for (auto chunk_index = size_t{0}; chunk_index < chunks.size(); ++chunk_index) {
+    chunks[chunk_index]->replace_segments(std::move(segments[chunk_index]), std::move(statistics[chunk_index]));
+  }
+}
+
+bool is_value_segment(const std::string& data_type, const std::shared_ptr<const BaseSegment>& segment) {
+  auto result = false;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    result = static_cast<bool>(std::dynamic_pointer_cast<const ValueSegment<Type>>(segment));
+  });
+  return result;
+}
+
+// The background compression shares its threads among all tables. Half of the cores are left for queries and ingest.
+WorkerPool& background_workers() {
+  static auto worker_pool = WorkerPool{std::max(1u, std::thread::hardware_concurrency() / 2)};
+  return worker_pool;
+}
+
+// returns the block of the chunk list that holds the chunk with the given id, and the chunk's position in the block
+std::pair<size_t, size_t> chunk_position(const ChunkID chunk_id) {
+  const auto position = uint64_t{chunk_id} + 1;
+  const auto block = static_cast<size_t>(63 - __builtin_clzll(position));
+  return {block, position - (uint64_t{1} << block)};
+}
+
+}  // namespace
+
+Table::Table(const ChunkOffset target_chunk_size, std::pmr::memory_resource* memory_resource, const UseMvcc use_mvcc)
+    : _target_chunk_size(target_chunk_size), _memory_resource(memory_resource), _use_mvcc(use_mvcc) {
+  Assert(use_mvcc == UseMvcc::No ||
+             (target_chunk_size > 0 && target_chunk_size < std::numeric_limits<ChunkOffset>::max() - 1),
+         "Tables with MVCC need a bounded target chunk size");
+  _add_chunk(_create_chunk());
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  _column_names.push_back(name);
+  _column_types.push_back(type);
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  Assert(row_count() == 0, "Columns can only be added to empty tables");
+  add_column_definition(name, type);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    _chunk(chunk_id)->add_segment(_create_value_segment(type));
+  }
+}
+
+void Table::append(const std::vector<AllTypeVariant>& values,
+                   const std::shared_ptr<TransactionContext>& transaction_context) {
+  if (_use_mvcc == UseMvcc::Yes) {
+    // the values are converted before the row is reserved, so that they can be set without errors
+    Assert(values.size() == column_count(), "Table::append: number of values does not match the column count");
+    auto row = std::vector<AllTypeVariant>(values.size());
+    for (auto column_id = ColumnID{0}; column_id < values.size(); ++column_id) {
+      resolve_data_type(_column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+        row[column_id] = type_cast<Type>(values[column_id]);
+      });
+    }
+    _append_concurrently(1, transaction_context,
+                         [&](Chunk& chunk, const ChunkOffset chunk_offset, const ChunkOffset, const ChunkOffset) {
+                           chunk.set_row(chunk_offset, row);
+                         });
+    return;
+  }
+
+  Assert(!transaction_context, "Table::append: only tables with MVCC can be appended to by transactions");
+  if (_last_chunk_is_full()) create_new_chunk();
+  auto& chunk = _last_chunk();
+  chunk.append(values);
+  const auto row_id = RowID{ChunkID{chunk_count() - 1}, chunk.size() - 1};
+  for (const auto& index : _indexes) index->insert(values, row_id);
+  if (_last_chunk_is_full()) _close_chunk(_chunk(row_id.chunk_id));
+}
+
+void Table::_append_concurrently(const ChunkOffset row_count,
+                                 const std::shared_ptr<TransactionContext>& transaction_context,
+                                 const std::function<void(Chunk&, ChunkOffset, ChunkOffset, ChunkOffset)>& set_rows) {
+  auto begin = ChunkOffset{0};
+  while (begin < row_count) {
+    const auto chunk_id = ChunkID{chunk_count() - 1};
+    const auto& chunk = _chunk(chunk_id);
+    const auto [chunk_offset, reserved_row_count] = chunk->reserve_rows(row_count - begin);
+    if (reserved_row_count == 0) {
+      // the writer that reserved the last row of the chunk is about to add the next one
+      while (chunk_count() == chunk_id + 1) std::this_thread::yield();
+      continue;
+    }
+
+    // the next chunk is added right away, so that the other writers do not wait for the rows to be written
+    auto& mvcc_data = *chunk->mvcc_data();
+    const auto end_offset = chunk_offset + reserved_row_count;
+    const auto fills_chunk = end_offset == mvcc_data.tids.size();
+    if (fills_chunk) _add_chunk(_create_chunk());
+
+    // the MVCC entries and values are written before the rows are published
+    const auto transaction_id =
+        transaction_context ? transaction_context->transaction_id() : INVALID_TRANSACTION_ID;
+    const auto begin_cid = transaction_context ? MAX_COMMIT_ID : CommitID{0};
+    for (auto offset = chunk_offset; offset < end_offset; ++offset) {
+      mvcc_data.tids[offset] = transaction_id;
+      mvcc_data.begin_cids[offset] = begin_cid;
+    }
+    try {
+      set_rows(*chunk, chunk_offset, begin, begin + reserved_row_count);
+    } catch (...) {
+      // The rows are published nevertheless, so that the chunk can be completed, but are visible to no transaction.
+      // Callers validate the values upfront, so this is not expected to happen.
+      for (auto offset = chunk_offset; offset < end_offset; ++offset) {
+        mvcc_data.tids[offset] = INVALID_TRANSACTION_ID;
+        mvcc_data.begin_cids[offset] = MAX_COMMIT_ID;
+      }
+      if (chunk->publish_rows(chunk_offset, reserved_row_count)) _close_chunk(chunk);
+      throw;
+    }
+    // the writer that completes the chunk closes it, which is not necessarily the one that reserved its last row
+    const auto completes_chunk = chunk->publish_rows(chunk_offset, reserved_row_count);
+
+    if (transaction_context) {
+      for (auto offset = chunk_offset; offset < end_offset; ++offset) {
+        transaction_context->register_insert(chunk->mvcc_data(), offset);
+      }
+    }
+    if (completes_chunk) _close_chunk(chunk);
+    begin += reserved_row_count;
+  }
+}
+
+bool Table::delete_row(const RowID row_id, const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto mvcc_data = get_chunk(row_id.chunk_id).mvcc_data();
+  Assert(mvcc_data, "Table::delete_row: only rows of tables with MVCC can be deleted");
+  const auto chunk_offset = row_id.chunk_offset;
+  if (!transaction_context->is_visible(*mvcc_data, chunk_offset)) return false;
+
+  // the row lock is taken by the first transaction that deletes the row, the own inserts are locked already
+  const auto transaction_id = transaction_context->transaction_id();
+  auto locking_transaction_id = INVALID_TRANSACTION_ID;
+  if (!mvcc_data->tids[chunk_offset].compare_exchange_strong(locking_transaction_id, transaction_id)) {
+    if (locking_transaction_id != transaction_id) return false;
+    // hides the own insert from the own transaction, see MvccData::is_visible
+    mvcc_data->end_cids[chunk_offset] = CommitID{0};
+  }
+  transaction_context->register_delete(mvcc_data, chunk_offset);
+  return true;
+}
+
+void Table::append_columns(std::vector<std::shared_ptr<BaseSegment>> columns) {
+  Assert(columns.size() == column_count(), "Table::append_columns: number of columns does not match the column count");
+  if (columns.empty()) return;
+  const auto row_count = columns.front()->size();
+  for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+    Assert(columns[column_id]->size() == row_count, "Table::append_columns: columns differ in length");
+    Assert(is_value_segment(_column_types[column_id], columns[column_id]),
+           "Table::append_columns: columns have to be ValueSegments of the column types");
+  }
+
+  // the rows are not inserted by a transaction and hence visible to all transactions once published
+  if (_use_mvcc == UseMvcc::Yes) {
+    _append_concurrently(row_count, nullptr,
+                         [&](Chunk& chunk, const ChunkOffset chunk_offset, const ChunkOffset begin,
+                             const ChunkOffset end) { chunk.set_rows(chunk_offset, columns, begin, end); });
+    return;
+  }
+
+  auto begin = ChunkOffset{0};
+  while (begin < row_count) {
+    if (_last_chunk_is_full()) create_new_chunk();
+    auto& chunk = _last_chunk();
+    const auto chunk_size = chunk.size();
+    const auto end =
+        _target_chunk_size == 0 ? row_count : std::min(row_count, begin + (_target_chunk_size - chunk_size));
+    if (chunk_size == 0 && end - begin == row_count && _can_adopt(columns)) {
+      chunk.replace_segments(columns, {});
+    } else {
+      chunk.append_columns(columns, begin, end);
+    }
+
+    // indexes are maintained row by row, which boxes the values
+    if (!_indexes.empty()) {
+      const auto chunk_id = ChunkID{chunk_count() - 1};
+      auto values = std::vector<AllTypeVariant>(columns.size());
+      for (auto offset = begin; offset < end; ++offset) {
+        for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+          values[column_id] = (*columns[column_id])[offset];
+        }
+        for (const auto& index : _indexes) index->insert(values, RowID{chunk_id, chunk_size + (offset - begin)});
+      }
+    }
+
+    if (_last_chunk_is_full()) _close_chunk(_chunk(ChunkID{chunk_count() - 1}));
+    begin = end;
+  }
 }
 
-void Table::append(const std::vector<AllTypeVariant>& values) {
-  // Implementation goes here
+bool Table::_can_adopt(const std::vector<std::shared_ptr<BaseSegment>>& columns) const {
+  for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+    // segments that the caller still holds would be appended to by later batches while the caller reads them
+    if (columns[column_id].use_count() != 1) return false;
+    auto allocates_from_table = false;
+    resolve_data_type(_column_types[column_id], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto& values = static_cast<const ValueSegment<Type>&>(*columns[column_id]).values();
+      allocates_from_table = values.get_allocator().resource()->is_equal(*_memory_resource);
+    });
+    if (!allocates_from_table) return false;
+  }
+  return true;
+}
+
+std::shared_ptr<Chunk> Table::_create_chunk() const {
+  auto chunk = std::make_shared<Chunk>();
+  for (const auto& type : _column_types) chunk->add_segment(_create_value_segment(type));
+  if (_use_mvcc == UseMvcc::Yes) chunk->set_mvcc_data(std::make_shared<MvccData>(_target_chunk_size));
+  return chunk;
+}
+
+std::shared_ptr<BaseSegment> Table::_create_value_segment(const std::string& type) const {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+    segment = std::make_shared<ValueSegment<Type>>(_memory_resource);
+  });
+  return segment;
+}
+
+std::shared_ptr<Chunk>& Table::_chunk(const ChunkID chunk_id) const {
+  DebugAssert(chunk_id < chunk_count(), "chunk_id out of range");
+  const auto [block, index] = chunk_position(chunk_id);
+  return _chunk_blocks[block][index];
+}
+
+void Table::_add_chunk(std::shared_ptr<Chunk> chunk) {
+  const auto chunk_id = ChunkID{_chunk_count.load()};
+  const auto [block, index] = chunk_position(chunk_id);
+  Assert(block < CHUNK_BLOCK_COUNT, "Table: too many chunks");
+  if (index == 0) _chunk_blocks[block] = std::make_unique<std::shared_ptr<Chunk>[]>(size_t{1} << block);
+  _chunk_blocks[block][index] = std::move(chunk);
+  _chunk_count.store(chunk_id + 1);
+}
+
+Chunk& Table::_last_chunk() const { return *_chunk(ChunkID{chunk_count() - 1}); }
+
+bool Table::_last_chunk_is_full() const {
+  return _target_chunk_size != 0 && _last_chunk().size() >= _target_chunk_size;
+}
+
+void Table::_close_chunk(const std::shared_ptr<Chunk>& chunk) {
+  chunk->finalize();
+  chunk->set_statistics(create_statistics(_column_types, get_segments(*chunk)));
+  if (!_background_compression_encoding) return;
+
+  const auto lock = std::lock_guard{_background_compressions_mutex};
+
+  // jobs that are done are forgotten, so that the list does not grow with the table. Their errors are kept for
+  // wait_for_background_compression.
+  const auto is_done = [&](auto& future) {
+    if (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) return false;
+    try {
+      future.get();
+    } catch (...) {
+      _background_compression_errors.push_back(std::current_exception());
+    }
+    return true;
+  };
+  _background_compressions.erase(
+      std::remove_if(_background_compressions.begin(), _background_compressions.end(), is_done),
+      _background_compressions.end());
+
+  // the job holds the chunk and copies the column types, so that it does not depend on the table or its chunk list
+  _background_compressions.push_back(background_workers().schedule(
+      [chunk, column_types = _column_types, encoding_type = *_background_compression_encoding,
+       memory_resource = _memory_resource] {
+        encode_chunk(*chunk, column_types, [&](const ColumnID column_id, const std::shared_ptr<BaseSegment>& segment) {
+          // the chunk might have been compressed manually in the meantime
+          if (!is_value_segment(column_types[column_id], segment)) return segment;
+          return encode_segment(encoding_type, column_types[column_id], segment, memory_resource);
+        });
+      }));
+}
+
+void Table::enable_background_compression(const EncodingType encoding_type) {
+  _background_compression_encoding = encoding_type;
+}
+
+void Table::wait_for_background_compression() {
+  auto background_compressions = std::vector<std::future<void>>{};
+  auto errors = std::vector<std::exception_ptr>{};
+  {
+    const auto lock = std::lock_guard{_background_compressions_mutex};
+    background_compressions = std::move(_background_compressions);
+    _background_compressions.clear();
+    errors = std::move(_background_compression_errors);
+    _background_compression_errors.clear();
+  }
+
+  for (auto& future : background_compressions) {
+    try {
+      future.get();
+    } catch (...) {
+      errors.push_back(std::current_exception());
+    }
+  }
+  if (!errors.empty()) std::rethrow_exception(errors.front());
 }
 
 void Table::create_new_chunk() {
-  // Implementation goes here
+  // full chunks were already closed when their last row was appended
+  if (_last_chunk().size() > 0 && !_last_chunk_is_full()) _close_chunk(_chunk(ChunkID{chunk_count() - 1}));
+  _add_chunk(_create_chunk());
+}
+
+void Table::emplace_chunk(Chunk chunk) {
+  if (chunk_count() == 1 && _last_chunk().size() == 0) {
+    _chunk(ChunkID{0}) = std::make_shared<Chunk>(std::move(chunk));
+  } else {
+    _add_chunk(std::make_shared<Chunk>(std::move(chunk)));
+  }
+
+  if (_indexes.empty()) return;
+  const auto chunk_id = ChunkID{chunk_count() - 1};
+  const auto& emplaced_chunk = *_chunk(chunk_id);
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  for (auto column_id = ColumnID{0}; column_id < emplaced_chunk.column_count(); ++column_id) {
+    segments.push_back(emplaced_chunk.get_segment(column_id));
+  }
+  auto values = std::vector<AllTypeVariant>(segments.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < emplaced_chunk.size(); ++chunk_offset) {
+    for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+      values[column_id] = (*segments[column_id])[chunk_offset];
+    }
+    for (const auto& index : _indexes) index->insert(values, RowID{chunk_id, chunk_offset});
+  }
 }
 
 ColumnCount Table::column_count() const {
-  // Implementation goes here
-  return ColumnCount{0};
+  return ColumnCount{static_cast<ColumnCount::base_type>(_column_names.size())};
 }
 
 uint64_t Table::row_count() const {
-  // Implementation goes here
-  return 0;
+  auto row_count = uint64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) row_count += _chunk(chunk_id)->size();
+  return row_count;
 }
 
-ChunkID Table::chunk_count() const {
-  // Implementation goes here
-  return ChunkID{0};
-}
+ChunkID Table::chunk_count() const { return ChunkID{_chunk_count.load()}; }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
-  // Implementation goes here
-  return ColumnID{0};
+  const auto it = std::find(_column_names.cbegin(), _column_names.cend(), column_name);
+  Assert(it != _column_names.cend(), "No column named " + column_name);
+  return ColumnID{static_cast<ColumnID::base_type>(std::distance(_column_names.cbegin(), it))};
 }
 
-ChunkOffset Table::target_chunk_size() const {
-  // Implementation goes here
-  return 0;
-}
+ChunkOffset Table::target_chunk_size() const { return _target_chunk_size; }
 
-const std::vector<std::string>& Table::column_names() const {
-  throw std::runtime_error("Implement Table::column_names()");
-}
+std::pmr::memory_resource* Table::memory_resource() const { return _memory_resource; }
+
+UseMvcc Table::uses_mvcc() const { return _use_mvcc; }
+
+const std::vector<std::string>& Table::column_names() const { return _column_names; }
 
 const std::string& Table::column_name(const ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_name");
+  DebugAssert(column_id < _column_names.size(), "column_id out of range");
+  return _column_names[column_id];
 }
 
 const std::string& Table::column_type(const ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_type");
+  DebugAssert(column_id < _column_types.size(), "column_id out of range");
+  return _column_types[column_id];
 }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { throw std::runtime_error("Implement Table::get_chunk"); }
+Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunk(chunk_id); }
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { throw std::runtime_error("Implement Table::get_chunk"); }
+const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunk(chunk_id); }
 
-void Table::compress_chunk(ChunkID chunk_id) { throw std::runtime_error("Implement Table::compress_chunk"); }
+void Table::compress_chunk(ChunkID chunk_id, const EncodingType encoding_type) {
+  compress_chunks({chunk_id}, encoding_type);
+}
+
+void Table::compress_chunks(const std::vector<ChunkID>& chunk_ids, const EncodingType encoding_type) {
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  chunks.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < chunk_count(), "chunk_id out of range");
+    chunks.push_back(_chunk(chunk_id));
+  }
+  encode_chunks(chunks, _column_types,
+                [&](const size_t, const ColumnID column_id, const std::shared_ptr<BaseSegment>& segment) {
+                  return encode_segment(encoding_type, _column_types[column_id], segment, _memory_resource);
+                });
+}
+
+std::vector<SegmentEncodingReport> Table::compress_chunk_automatically(ChunkID chunk_id) {
+  Assert(chunk_id < chunk_count(), "chunk_id out of range");
+  auto reports = std::vector<SegmentEncodingReport>(column_count());
+  encode_chunks({_chunk(chunk_id)}, _column_types,
+                [&](const size_t, const ColumnID column_id, const std::shared_ptr<BaseSegment>& segment) {
+                  const auto advice = advise_encoding(_column_types[column_id], *segment);
+                  auto encoded_segment =
+                      encode_segment(advice.spec, _column_types[column_id], segment, _memory_resource);
+                  reports[column_id] = {column_id, advice.spec, advice.estimated_memory_usage,
+                                        encoded_segment->estimate_memory_usage()};
+                  return encoded_segment;
+                });
+  return reports;
+}
+
+std::shared_ptr<const BPlusTreeIndex> Table::create_index(const std::vector<ColumnID>& column_ids) {
+  Assert(_use_mvcc == UseMvcc::No, "Tables with MVCC do not support indexes");
+  Assert(!get_index(column_ids), "Table already has an index on these columns");
+  auto index = std::make_shared<BPlusTreeIndex>(*this, column_ids);
+  _indexes.push_back(index);
+  return index;
+}
+
+std::shared_ptr<const BPlusTreeIndex> Table::get_index(const std::vector<ColumnID>& column_ids) const {
+  const auto it = std::find_if(_indexes.cbegin(), _indexes.cend(),
+                               [&](const auto& index) { return index->column_ids() == column_ids; });
+  return it != _indexes.cend() ? *it : nullptr;
+}
 
 }  // namespace opossum
@@ -1,31 +1,56 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_advisor.hpp"
+#include "encoding_type.hpp"
+#include "value_segment.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_resources.hpp"
 
 namespace opossum {
 
+class BPlusTreeIndex;
 class TableStatistics;
+class TransactionContext;
 
 // A table is partitioned horizontally into a number of chunks
+//
+// Chunks can be read while chunks are added, as the chunk list never moves them. Tables with MVCC can moreover be
+// appended to by many writers at once: each writer reserves rows of the last chunk and sets their values itself, and
+// the writer that reserves the last row of a chunk adds the next one. Readers only see the rows that are fully written.
 class Table : private Noncopyable {
  public:
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
-  // default is the maximum chunk size minus 1. A table holds always at least one chunk
-  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  // default is the maximum chunk size minus 1, 0 means that chunks are never full
+  // A table holds always at least one chunk
+  // The segments of the table are allocated from memory_resource, e.g., huge_page_memory_resource() for large tables
+  // that are accessed randomly.
+  // Tables with MVCC allocate the segments and MVCC columns of each chunk for target_chunk_size rows upfront, which
+  // therefore has to be bounded. Their chunks can be scanned while rows are appended concurrently (see Chunk).
+  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 std::pmr::memory_resource* memory_resource = storage_memory_resource(),
+                 const UseMvcc use_mvcc = UseMvcc::No);
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   ColumnCount column_count() const;
@@ -42,7 +67,8 @@ class Table : private Noncopyable {
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. The rows of the chunk are inserted into the
+  // indexes of the table.
   void emplace_chunk(Chunk chunk);
 
   // Returns a list of all column names.
@@ -62,6 +88,12 @@ class Table : private Noncopyable {
   // return the target chunk size (cannot exceed ChunkOffset (uint32_t))
   ChunkOffset target_chunk_size() const;
 
+  // returns the resource that the segments of this table are allocated from
+  std::pmr::memory_resource* memory_resource() const;
+
+  // returns whether the chunks of the table have MVCC columns
+  UseMvcc uses_mvcc() const;
+
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
@@ -73,16 +105,124 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
-  void append(const std::vector<AllTypeVariant>& values);
-
-  // creates a new chunk and appends it
+  // note this is slow and should be used for testing purposes only. It is only thread-safe for tables with MVCC.
+  // In tables with MVCC, the row is inserted by the given transaction, i.e., it becomes visible to other transactions
+  // once that commits. Rows appended without a transaction are visible to all transactions right away.
+  void append(const std::vector<AllTypeVariant>& values,
+              const std::shared_ptr<TransactionContext>& transaction_context = nullptr);
+
+  // Appends the rows of a batch given column by column as ValueSegments of the column types. The values are copied
+  // into the ValueSegments of the table without boxing them into AllTypeVariants, and the batch is split across chunks
+  // at the target chunk size. A batch that fits into an empty chunk of a table without MVCC and whose values are
+  // allocated from memory_resource() is not copied if the table is the only owner of its ValueSegments, e.g., if a
+  // vector of them is moved in: the chunk takes them over. Segments of the table itself cannot be appended.
+  // Thread-safe for tables with MVCC, in which the rows of concurrent batches may interleave.
+  void append_columns(std::vector<std::shared_ptr<BaseSegment>> columns);
+
+  // Same as above, for a batch given as one typed column of values per column of the table, e.g.,
+  // table.append_columns(std::move(ids), std::move(names)). Moved pmr_vector<T>s become segments of the table, spans
+  // are copied into segments allocated from memory_resource().
+  template <typename... Types>
+  void append_columns(pmr_vector<Types>&&... columns) {
+    // not built from an initializer list, which would hold further references to the segments during the call
+    auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+    segments.reserve(sizeof...(Types));
+    (segments.push_back(std::make_shared<ValueSegment<Types>>(std::move(columns))), ...);
+    append_columns(std::move(segments));
+  }
+
+  template <typename... Types>
+  void append_columns(std::span<const Types>... columns) {
+    append_columns(pmr_vector<Types>(columns.begin(), columns.end(), _memory_resource)...);
+  }
+
+  // Deletes a row of a table with MVCC on behalf of the given transaction. Returns false if the row is not visible to
+  // the transaction or is being deleted by another one, i.e., if the transaction conflicts and should be rolled back.
+  bool delete_row(const RowID row_id, const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // creates a new chunk and appends it. The previous chunk is closed, i.e., will not be appended to anymore.
+  // Must not be called while rows are appended.
   void create_new_chunk();
 
-  // compresses a ValueColumn into a DictionaryColumn
-  void compress_chunk(ChunkID chunk_id);
+  // Compresses the ValueSegments of a chunk using the given encoding, e.g., into DictionarySegments. Chunks of tables
+  // with MVCC have to be full or finalized, see Chunk::finalize.
+  void compress_chunk(ChunkID chunk_id, const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // same as compress_chunk, but encodes all segments of the given chunks in parallel
+  void compress_chunks(const std::vector<ChunkID>& chunk_ids,
+                       const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // From now on, chunks are compressed by background workers as soon as they are closed, i.e., when they reach the
+  // target chunk size or a new chunk is created. Until the compressed segments are swapped in, readers see the
+  // uncompressed ones.
+  void enable_background_compression(const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Blocks until all chunks handed to the background workers are compressed. Rethrows the first error of the
+  // compressions since the last call, including those of jobs that finished long ago.
+  void wait_for_background_compression();
+
+  // compresses each ValueSegment of a chunk using the encoding chosen by advise_encoding and reports the chosen
+  // encodings together with their estimated and actual memory usage
+  std::vector<SegmentEncodingReport> compress_chunk_automatically(ChunkID chunk_id);
+
+  // creates a B+-tree index on the given columns over all chunks, which is updated by append
+  // Tables with MVCC do not support indexes, as they are appended to concurrently.
+  std::shared_ptr<const BPlusTreeIndex> create_index(const std::vector<ColumnID>& column_ids);
+
+  // returns the B+-tree index on exactly the given columns, or nullptr if there is none
+  std::shared_ptr<const BPlusTreeIndex> get_index(const std::vector<ColumnID>& column_ids) const;
 
  protected:
-  // Implementation goes here
+  // creates an empty chunk with one ValueSegment per column, and MVCC columns if the table uses MVCC
+  std::shared_ptr<Chunk> _create_chunk() const;
+  std::shared_ptr<BaseSegment> _create_value_segment(const std::string& type) const;
+
+  // returns the entry of the chunk list that holds the chunk with the given id
+  std::shared_ptr<Chunk>& _chunk(const ChunkID chunk_id) const;
+
+  // Adds a chunk to the chunk list and publishes it to readers. Only one writer may add chunks at a time, which for
+  // concurrent appends is the one that reserved the last row of the previous chunk.
+  void _add_chunk(std::shared_ptr<Chunk> chunk);
+
+  // Appends row_count rows to a table with MVCC, concurrently with other writers. set_rows(chunk, chunk_offset, begin,
+  // end) sets the values of the rows [begin, end), which were reserved in chunk from chunk_offset on. Writers do not
+  // wait for each other. If set_rows throws, the reserved rows are published as rows that no transaction sees.
+  void _append_concurrently(
+      const ChunkOffset row_count, const std::shared_ptr<TransactionContext>& transaction_context,
+      const std::function<void(Chunk&, ChunkOffset, ChunkOffset, ChunkOffset)>& set_rows);
+
+  // returns the last chunk
+  Chunk& _last_chunk() const;
+
+  // returns whether the last chunk has reached the target chunk size
+  bool _last_chunk_is_full() const;
+
+  // returns whether the table owns the ValueSegments of a batch for append_columns, which are allocated from the
+  // memory resource of the table
+  bool _can_adopt(const std::vector<std::shared_ptr<BaseSegment>>& columns) const;
+
+  // finalizes the chunk, creates its statistics and hands it to the background compression, if enabled
+  void _close_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  const ChunkOffset _target_chunk_size;
+  std::pmr::memory_resource* const _memory_resource;
+  const UseMvcc _use_mvcc;
+
+  // The chunk list consists of blocks that are allocated on demand and never moved, block b holds 2^b chunks. Readers
+  // only access the chunks below _chunk_count, which is incremented after a chunk is added.
+  static constexpr auto CHUNK_BLOCK_COUNT = size_t{32};
+  std::array<std::unique_ptr<std::shared_ptr<Chunk>[]>, CHUNK_BLOCK_COUNT> _chunk_blocks;
+  std::atomic<ChunkID::base_type> _chunk_count{0};
+
+  std::vector<std::string> _column_names;
+  std::vector<std::string> _column_types;
+  std::vector<std::shared_ptr<BPlusTreeIndex>> _indexes;
+
+  std::optional<EncodingType> _background_compression_encoding;
+  std::vector<std::future<void>> _background_compressions;
+  // errors of finished jobs that were removed from _background_compressions
+  std::vector<std::exception_ptr> _background_compression_errors;
+  // chunks filled by concurrent appends are closed by their last writer
+  std::mutex _background_compressions_mutex;
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -12,26 +13,81 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::pmr::memory_resource* memory_resource) : _values(memory_resource) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(pmr_vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
-  throw std::runtime_error("Implement ValueSegment::operator[]");
+  DebugAssert(chunk_offset < _values.size(), "ValueSegment: chunk_offset out of range");
+  return _values[chunk_offset];
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
-  // Implementation goes here
+  _values.push_back(type_cast<T>(val));
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(const std::span<const T> values) {
+  _values.insert(_values.end(), values.begin(), values.end());
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(const BaseValueSegment& source, const ChunkOffset begin, const ChunkOffset end) {
+  const auto* typed_source = dynamic_cast<const ValueSegment<T>*>(&source);
+  Assert(typed_source, "ValueSegment::append_values: source has a different data type");
+  // the values would be inserted from the vector they are inserted into, which might reallocate
+  Assert(typed_source != this, "ValueSegment::append_values: a segment cannot be appended to itself");
+  DebugAssert(begin <= end && end <= typed_source->size(), "ValueSegment::append_values: range out of bounds");
+  append_values(std::span<const T>{typed_source->_values}.subspan(begin, end - begin));
+}
+
+template <typename T>
+void ValueSegment<T>::set(const ChunkOffset chunk_offset, const AllTypeVariant& value) {
+  DebugAssert(chunk_offset < _values.size(), "ValueSegment::set: chunk_offset out of range");
+  _values[chunk_offset] = type_cast<T>(value);
+}
+
+template <typename T>
+void ValueSegment<T>::set_values(const ChunkOffset chunk_offset, const BaseValueSegment& source,
+                                 const ChunkOffset begin, const ChunkOffset end) {
+  const auto* typed_source = dynamic_cast<const ValueSegment<T>*>(&source);
+  Assert(typed_source, "ValueSegment::set_values: source has a different data type");
+  Assert(typed_source != this, "ValueSegment::set_values: a segment cannot be copied into itself");
+  DebugAssert(begin <= end && end <= typed_source->size(), "ValueSegment::set_values: range out of bounds");
+  DebugAssert(chunk_offset + (end - begin) <= _values.size(), "ValueSegment::set_values: chunk_offset out of range");
+  const auto* values = typed_source->_values.data();
+  std::copy(values + begin, values + end, _values.begin() + chunk_offset);
+}
+
+template <typename T>
+void ValueSegment<T>::resize(const ChunkOffset size) {
+  _values.resize(size);
+}
+
+template <typename T>
+std::shared_ptr<BaseValueSegment> ValueSegment<T>::copy_prefix(const ChunkOffset size) const {
+  DebugAssert(size <= _values.size(), "ValueSegment::copy_prefix: size out of range");
+  return std::make_shared<ValueSegment<T>>(pmr_vector<T>(_values.cbegin(), _values.cbegin() + size,
+                                                         _values.get_allocator()));
 }
 
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
-  // Implementation goes here
-  return 0;
+  return static_cast<ChunkOffset>(_values.size());
+}
+
+template <typename T>
+const pmr_vector<T>& ValueSegment<T>::values() const {
+  return _values;
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  // Implementation goes here
-  return 0;
+  return sizeof(T) * _values.size();
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
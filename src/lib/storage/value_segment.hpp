@@ -1,37 +1,59 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base_segment.hpp"
+#include "base_value_segment.hpp"
 
 namespace opossum {
 
 // ValueSegment is a segment type that stores all its values in a vector
 template <typename T>
-class ValueSegment : public BaseSegment {
+class ValueSegment : public BaseValueSegment {
  public:
+  // creates an empty segment that allocates its values from the given memory resource
+  explicit ValueSegment(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a segment that takes over the given values, e.g., a column of a batch for Table::append_columns
+  explicit ValueSegment(pmr_vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // add a value to the end
   void append(const AllTypeVariant& val) final;
 
+  // adds the given values to the end, which must not be values of this segment
+  void append_values(std::span<const T> values);
+
+  // same as above, but for the values of another ValueSegment of type T
+  void append_values(const BaseValueSegment& source, ChunkOffset begin, ChunkOffset end) final;
+
+  void set(const ChunkOffset chunk_offset, const AllTypeVariant& value) final;
+  void set_values(const ChunkOffset chunk_offset, const BaseValueSegment& source, const ChunkOffset begin,
+                  const ChunkOffset end) final;
+
+  void resize(const ChunkOffset size) final;
+
+  std::shared_ptr<BaseValueSegment> copy_prefix(const ChunkOffset size) const final;
+
   // return the number of entries
   ChunkOffset size() const final;
 
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const pmr_vector<T>& values() const;
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final;
 
  protected:
-  // Implementation goes here
+  pmr_vector<T> _values;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -38,6 +39,18 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Commit ids order the commits of transactions, transaction ids identify them while they run (see MvccData)
+using CommitID = uint32_t;
+using TransactionID = uint32_t;
+
+// the begin or end commit id of rows that are not committed or not deleted (yet)
+constexpr auto MAX_COMMIT_ID = std::numeric_limits<CommitID>::max();
+// the transaction id of rows that are not locked by any transaction
+constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
+
+// tables with MVCC track which rows are visible to which transactions (see Table)
+enum class UseMvcc : bool { No, Yes };
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -54,7 +67,12 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// Vectors whose memory comes from a std::pmr::memory_resource, e.g., the pool of the storage or the arena of an
+// operator
+template <typename T>
+using pmr_vector = std::pmr::vector<T>;
+
+using PosList = pmr_vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace opossum {
+
+// Hashes a value such that all bits of the result depend on the value. std::hash is the identity for integers, so its
+// result is mixed using the finalizer of MurmurHash3. Used by probabilistic data structures, which consume the hash
+// bit by bit.
+template <typename T>
+uint64_t mixed_hash(const T& value) {
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
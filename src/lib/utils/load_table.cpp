@@ -1,34 +1,233 @@
 #include "load_table.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <limits>
 #include <memory>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_statistics.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/mapped_file.hpp"
+#include "utils/worker_pool.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+namespace {
+
+// Ranges are not split any further to avoid scheduling overhead for small files
+constexpr auto MIN_RANGE_SIZE = size_t{1} << 20;
+
+// Parses the fields of one column into a typed buffer. The virtual call per field replaces the AllTypeVariant and the
+// string that used to be created for each field.
+class BaseColumnParser {
+ public:
+  virtual ~BaseColumnParser() = default;
+
+  virtual void parse(const char* begin, const char* end) = 0;
+
+  // moves the parsed values into a ValueSegment
+  virtual std::shared_ptr<BaseSegment> finish() = 0;
+};
+
+template <typename T>
+class ColumnParser : public BaseColumnParser {
+ public:
+  void parse(const char* begin, const char* end) final {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.emplace_back(begin, end);
+    } else {
+      auto value = T{};
+      const auto [position, error] = std::from_chars(begin, end, value);
+      Assert(error == std::errc() && position == end, "load_table: Could not parse '" + std::string(begin, end) + "'");
+      _values.push_back(value);
+    }
+  }
+
+  std::shared_ptr<BaseSegment> finish() final { return std::make_shared<ValueSegment<T>>(std::move(_values)); }
+
+ protected:
+  pmr_vector<T> _values;
+};
+
+// returns the position of the line break that ends the line starting at begin, or end for the last line
+const char* find_line_end(const char* begin, const char* end) {
+  const auto* line_end = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+  return line_end ? line_end : end;
+}
+
+std::vector<std::string> split_header_line(const char*& position, const char* end) {
+  auto line_end = find_line_end(position, end);
+  const auto next_line = line_end == end ? end : line_end + 1;
+  if (line_end > position && *(line_end - 1) == '\r') --line_end;
+  auto fields = _split<std::string>(std::string{position, line_end}, '|');
+  position = next_line;
+  return fields;
+}
+
+// Parses the lines in [begin, end), which has to start at the beginning of a line, into one ValueSegment per column
+std::vector<std::shared_ptr<BaseSegment>> parse_range(const char* begin, const char* end,
+                                                      const std::vector<std::string>& column_types) {
+  auto parsers = std::vector<std::unique_ptr<BaseColumnParser>>{};
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      parsers.push_back(std::make_unique<ColumnParser<Type>>());
+    });
+  }
+
+  auto position = begin;
+  while (position < end) {
+    auto line_end = find_line_end(position, end);
+    const auto next_line = line_end == end ? end : line_end + 1;
+    if (line_end > position && *(line_end - 1) == '\r') --line_end;
+    if (line_end == position) {
+      position = next_line;
+      continue;
+    }
+
+    for (auto column_id = size_t{0}; column_id < parsers.size(); ++column_id) {
+      const auto* field_end = std::find(position, line_end, '|');
+      Assert(field_end != line_end || column_id + 1 == parsers.size(), "load_table: line has too few fields");
+      parsers[column_id]->parse(position, field_end);
+      position = field_end + 1;
+    }
+    // a delimiter after the last field is accepted, as in files written with one after every field
+    Assert(position == line_end + 1 || (position == line_end && *(line_end - 1) == '|'),
+           "load_table: line has too many fields");
+    position = next_line;
+  }
+
+  auto columns = std::vector<std::shared_ptr<BaseSegment>>{};
+  for (const auto& parser : parsers) columns.push_back(parser->finish());
+  return columns;
+}
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> column_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> column_types = _split<std::string>(line, '|');
+// creates an empty table with the columns defined by the first two lines and moves position past them
+std::shared_ptr<Table> create_table(const char*& position, const char* end, const size_t chunk_size) {
+  const auto column_names = split_header_line(position, end);
+  const auto column_types = split_header_line(position, end);
+  Assert(column_names.size() == column_types.size(), "load_table: Number of column names and types does not match");
 
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
+  auto table = std::make_shared<Table>(chunk_size);
   for (auto column_id = ColumnID{0}; column_id < column_names.size(); column_id++) {
-    test_table->add_column(column_names[column_id], column_types[column_id]);
+    table->add_column(column_names[column_id], column_types[column_id]);
+  }
+  return table;
+}
+
+// returns the end of the row_count non-empty lines that start at begin, or end if there are fewer
+const char* find_rows_end(const char* begin, const char* end, const size_t row_count) {
+  auto position = begin;
+  for (auto row = size_t{0}; row < row_count && position < end;) {
+    const auto* line_end = find_line_end(position, end);
+    if (line_end > position && !(line_end == position + 1 && *position == '\r')) ++row;
+    position = line_end == end ? end : line_end + 1;
+  }
+  return position;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
+  const auto file = MappedFile{file_name};
+  const auto* position = file.data();
+  const auto* const end = file.data() + file.size();
+  auto table = create_table(position, end, chunk_size);
+  auto column_types = std::vector<std::string>{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    column_types.push_back(table->column_type(column_id));
+  }
+
+  // The rows are split into ranges that end at line breaks, which are parsed in parallel and appended in order
+  const auto body_size = static_cast<size_t>(end - position);
+  const auto range_count =
+      std::max(size_t{1}, std::min(size_t{std::thread::hardware_concurrency()} * 4, body_size / MIN_RANGE_SIZE));
+  auto range_bounds = std::vector<std::pair<const char*, const char*>>{};
+  while (position < end) {
+    const auto* range_end = std::min(end, position + body_size / range_count);
+    range_end = range_end == end ? end : std::min(end, find_line_end(range_end, end) + 1);
+    range_bounds.emplace_back(position, range_end);
+    position = range_end;
   }
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  auto ranges = std::vector<std::vector<std::shared_ptr<BaseSegment>>>(range_bounds.size());
+  auto jobs = std::vector<std::future<void>>{};
+  auto worker_pool = WorkerPool{std::min(range_bounds.size(), size_t{std::thread::hardware_concurrency()})};
+  for (auto range_index = size_t{0}; range_index < range_bounds.size(); ++range_index) {
+    jobs.push_back(worker_pool.schedule([&, range_index] {
+      const auto [begin, range_end] = range_bounds[range_index];
+      ranges[range_index] = parse_range(begin, range_end, column_types);
+    }));
   }
-  return test_table;
+
+  // if a range cannot be parsed, the destructor of the worker pool waits for the remaining jobs
+  for (auto range_index = size_t{0}; range_index < range_bounds.size(); ++range_index) {
+    jobs[range_index].get();
+    table->append_columns(std::move(ranges[range_index]));
+    ranges[range_index].clear();
+  }
+  return table;
+}
+
+std::shared_ptr<Table> load_compressed_table(const std::string& file_name, size_t chunk_size,
+                                             const EncodingType encoding_type) {
+  const auto file = MappedFile{file_name};
+  const auto* position = file.data();
+  const auto* const end = file.data() + file.size();
+  auto table = create_table(position, end, chunk_size);
+  auto column_types = std::vector<std::string>{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    column_types.push_back(table->column_type(column_id));
+  }
+
+  // Each job parses the lines of one chunk and compresses them. Only thread_count jobs are in flight, so that the
+  // uncompressed values of at most one chunk per worker are in memory at a time.
+  struct PendingChunk {
+    std::future<void> job;
+    std::shared_ptr<Chunk> chunk;
+  };
+  auto pending_chunks = std::deque<PendingChunk>{};
+  auto worker_pool = WorkerPool{};
+  const auto emit_oldest_chunk = [&] {
+    pending_chunks.front().job.get();
+    table->emplace_chunk(std::move(*pending_chunks.front().chunk));
+    pending_chunks.pop_front();
+  };
+
+  const auto rows_per_chunk = chunk_size == 0 ? std::numeric_limits<size_t>::max() : chunk_size;
+  while (position < end) {
+    const auto* chunk_end = find_rows_end(position, end, rows_per_chunk);
+    if (pending_chunks.size() == worker_pool.thread_count()) emit_oldest_chunk();
+
+    auto chunk = std::make_shared<Chunk>();
+    auto job = worker_pool.schedule([&, chunk, begin = position, chunk_end] {
+      auto statistics = std::vector<std::shared_ptr<const SegmentStatistics>>{};
+      const auto columns = parse_range(begin, chunk_end, column_types);
+      for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+        chunk->add_segment(
+            encode_segment(encoding_type, column_types[column_id], columns[column_id], table->memory_resource()));
+        statistics.push_back(create_segment_statistics(column_types[column_id], *chunk->get_segment(column_id)));
+      }
+      chunk->set_statistics(std::move(statistics));
+    });
+    pending_chunks.push_back({std::move(job), std::move(chunk)});
+    position = chunk_end;
+  }
+
+  // if a chunk cannot be parsed, the destructor of the worker pool waits for the remaining jobs
+  while (!pending_chunks.empty()) emit_oldest_chunk();
+  return table;
 }
 
 }  // namespace opossum
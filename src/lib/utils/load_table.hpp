@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include "storage/encoding_type.hpp"
+
 namespace opossum {
 
 class Table;
@@ -22,7 +24,15 @@ std::vector<T> _split(const std::string& str, char delimiter) {
   return internal;
 }
 
-// This is a helper method which is heavily used in our test suite
+// This is a helper method which is heavily used in our test suite. It loads a .tbl file, whose first two lines hold
+// the column names and types, separated by '|'. The file is memory-mapped and split into ranges of whole lines that
+// are parsed into typed columns on all cores, which are then appended to the table in order.
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
 
+// Streaming variant of load_table for tables that only fit into memory once they are compressed. The lines of each
+// chunk are parsed and encoded by a worker as soon as they are found, and the compressed chunks are added to the table
+// in order. At most one uncompressed chunk per worker is held in memory.
+std::shared_ptr<Table> load_compressed_table(const std::string& file_name, size_t chunk_size,
+                                             const EncodingType encoding_type = EncodingType::Dictionary);
+
 }  // namespace opossum
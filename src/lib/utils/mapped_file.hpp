@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for the lifetime of the object. Pages are read from disk only when they are
+// accessed for the first time, and the operating system may drop them again under memory pressure.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+  ~MappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ protected:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include "memory_resources.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <new>
+
+namespace opossum {
+
+namespace {
+
+size_t round_to_huge_pages(const size_t bytes) {
+  constexpr auto HUGE_PAGE_SIZE = HugePageMemoryResource::HUGE_PAGE_SIZE;
+  return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+}
+
+void* map_anonymous(const size_t size, const int additional_flags) {
+  const auto flags = MAP_PRIVATE | MAP_ANONYMOUS | additional_flags;
+  auto* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+  return memory == MAP_FAILED ? nullptr : memory;
+}
+
+// maps size bytes aligned to the huge page size, so that the kernel can back them with transparent huge pages
+void* map_aligned(const size_t size) {
+  constexpr auto HUGE_PAGE_SIZE = HugePageMemoryResource::HUGE_PAGE_SIZE;
+  auto* const memory = static_cast<char*>(map_anonymous(size + HUGE_PAGE_SIZE, 0));
+  if (!memory) return nullptr;
+
+  // the unaligned head and the remaining tail are unmapped again
+  const auto address = reinterpret_cast<uintptr_t>(memory);
+  auto* const aligned_memory = memory + (round_to_huge_pages(address) - address);
+  if (aligned_memory > memory) munmap(memory, aligned_memory - memory);
+  munmap(aligned_memory + size, memory + size + HUGE_PAGE_SIZE - (aligned_memory + size));
+
+#ifdef MADV_HUGEPAGE
+  // fails if transparent huge pages are not supported, in which case the regular pages are used
+  madvise(aligned_memory, size, MADV_HUGEPAGE);
+#endif
+  return aligned_memory;
+}
+
+}  // namespace
+
+std::pmr::memory_resource* storage_memory_resource() {
+  // never destroyed, as segments of static tables (e.g., in the StorageManager) may be released after it otherwise
+  static auto* const memory_resource = new std::pmr::synchronized_pool_resource{};
+  return memory_resource;
+}
+
+HugePageMemoryResource::HugePageMemoryResource(std::pmr::memory_resource* upstream, const size_t min_size)
+    : _upstream(upstream), _min_size(min_size) {}
+
+size_t HugePageMemoryResource::mapped_size() const { return _mapped_size; }
+
+void* HugePageMemoryResource::do_allocate(const size_t bytes, const size_t alignment) {
+  if (!_is_mapped(bytes, alignment)) return _upstream->allocate(bytes, alignment);
+
+  const auto size = round_to_huge_pages(bytes);
+  auto* memory = static_cast<void*>(nullptr);
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+  // explicitly 2^21 byte pages, as the mapping is unmapped with this size even if the default huge page size differs
+  memory = map_anonymous(size, MAP_HUGETLB | (21 << MAP_HUGE_SHIFT));
+#endif
+  if (!memory) memory = map_aligned(size);
+  if (!memory) throw std::bad_alloc{};
+
+  _mapped_size += size;
+  return memory;
+}
+
+void HugePageMemoryResource::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  if (!_is_mapped(bytes, alignment)) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  const auto size = round_to_huge_pages(bytes);
+  munmap(pointer, size);
+  _mapped_size -= size;
+}
+
+bool HugePageMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+bool HugePageMemoryResource::_is_mapped(const size_t bytes, const size_t alignment) const {
+  return bytes >= _min_size && alignment <= HUGE_PAGE_SIZE;
+}
+
+std::pmr::memory_resource* huge_page_memory_resource() {
+  // never destroyed for the same reason as the storage_memory_resource
+  static auto* const memory_resource = new HugePageMemoryResource{};
+  return memory_resource;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+
+namespace opossum {
+
+// Returns the resource that tables allocate their segments from by default. It pools blocks of similar sizes, so that
+// the many small buffers of short chunks and dictionaries are reused instead of going through the global allocator
+// each time. It is thread-safe and lives until the end of the program.
+std::pmr::memory_resource* storage_memory_resource();
+
+// HugePageMemoryResource backs large buffers, e.g., the values, attribute vectors, and dictionaries of full segments,
+// with 2 MB pages, so that random accesses into them cause fewer TLB misses. It first asks for pages of the hugetlbfs
+// pool (MAP_HUGETLB). If none are reserved, it maps 2 MB-aligned memory and advises the kernel to use transparent huge
+// pages for it (MADV_HUGEPAGE), which silently falls back to regular pages if those are disabled. Allocations smaller
+// than min_size are forwarded to the upstream resource. Thread-safe.
+class HugePageMemoryResource : public std::pmr::memory_resource {
+ public:
+  static constexpr auto HUGE_PAGE_SIZE = size_t{2} * 1024 * 1024;
+
+  explicit HugePageMemoryResource(std::pmr::memory_resource* upstream = storage_memory_resource(),
+                                  const size_t min_size = HUGE_PAGE_SIZE);
+
+  // returns the number of bytes that are currently mapped, i.e., not forwarded to the upstream resource
+  size_t mapped_size() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  bool _is_mapped(const size_t bytes, const size_t alignment) const;
+
+  std::pmr::memory_resource* const _upstream;
+  const size_t _min_size;
+  std::atomic<size_t> _mapped_size{0};
+};
+
+// Returns a HugePageMemoryResource on top of storage_memory_resource(), which lives until the end of the program. Pass
+// it to the constructor of a table to back its segments with huge pages.
+std::pmr::memory_resource* huge_page_memory_resource();
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+// Sorts (key, value) pairs by their integral key using a least-significant-digit radix sort with 8-bit digits. The sort
+// is stable and takes one counting and one scatter pass per byte of the key. Bytes in which all keys are equal (e.g.,
+// the upper bytes of small numbers) are skipped after counting.
+template <typename Key, typename Value>
+void radix_sort_by_key(std::vector<std::pair<Key, Value>>& entries) {
+  static_assert(std::is_integral_v<Key>, "radix_sort_by_key only supports integral keys");
+  using UnsignedKey = std::make_unsigned_t<Key>;
+  constexpr auto KEY_BITS = sizeof(Key) * 8;
+
+  // flipping the sign bit orders negative numbers before positive ones when the keys are compared as unsigned
+  constexpr auto SIGN_FLIP = std::is_signed_v<Key> ? static_cast<UnsignedKey>(UnsignedKey{1} << (KEY_BITS - 1))
+                                                   : UnsignedKey{0};
+  const auto digit = [&](const Key key, const size_t shift) {
+    return static_cast<size_t>((static_cast<UnsignedKey>(static_cast<UnsignedKey>(key) ^ SIGN_FLIP) >> shift) & 0xFF);
+  };
+
+  if (entries.size() < 2) return;
+  auto buffer = std::vector<std::pair<Key, Value>>(entries.size());
+  for (auto shift = size_t{0}; shift < KEY_BITS; shift += 8) {
+    auto offsets = std::array<size_t, 256>{};
+    for (const auto& entry : entries) ++offsets[digit(entry.first, shift)];
+    if (offsets[digit(entries.front().first, shift)] == entries.size()) continue;
+
+    auto offset = size_t{0};
+    for (auto& count : offsets) {
+      const auto bucket_size = count;
+      count = offset;
+      offset += bucket_size;
+    }
+    for (auto& entry : entries) buffer[offsets[digit(entry.first, shift)]++] = std::move(entry);
+    entries.swap(buffer);
+  }
+}
+
+}  // namespace opossum
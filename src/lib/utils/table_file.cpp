@@ -0,0 +1,521 @@
+#include "table_file.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/mapped_attribute_vector.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/simd_bp128_attribute_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Bump the version whenever the layout changes. All numbers are stored in the byte order of the machine, and all
+// arrays that are read in place start at offsets that are multiples of 8.
+constexpr char MAGIC[8] = {'O', 'P', 'O', 'S', 'S', 'U', 'M', 'T'};
+constexpr uint32_t VERSION = 2;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t target_chunk_size;
+  uint32_t column_count;
+  uint32_t chunk_count;
+};
+
+enum class SegmentKind : uint32_t { Value, Dictionary, FrontCodedDictionary, RunLength, FrameOfReference };
+
+// Each segment is stored in the layout of its encoding, so that it is restored with the same type and memory usage:
+//  - Value: the values
+//  - Dictionary: the entry_count values of the dictionary, then the attribute vector
+//  - FrontCodedDictionary: the size of the encoded blocks in bytes as uint64_t, the offset of each of the
+//    ceil(entry_count / block_size) blocks, the encoded blocks, and then the attribute vector
+//  - RunLength: the values of the entry_count runs, then the end position of each run
+//  - FrameOfReference: the minima of the entry_count blocks, then the offsets as an attribute vector
+// Strings are stored as count + 1 uint32_t offsets into the characters that follow them, fixed-width types as an
+// array. Every part starts at the next multiple of 8.
+struct SegmentHeader {
+  SegmentKind kind;
+  uint32_t size;
+  uint32_t entry_count;
+  uint32_t block_size;
+};
+
+enum class AttributeVectorKind : uint32_t { FixedSize, BitPacked, SimdBp128 };
+
+// Attribute vectors are followed by their value ids:
+//  - FixedSize: one value id of `width` bytes per row, which are read in place
+//  - BitPacked: the 64-bit words with value ids of `width` bits
+//  - SimdBp128: the reference and the bit width of each block, then the 32-bit words of all blocks. `width` is the
+//    width of the widest value id in bytes.
+// Attribute vectors of any other type are stored as FixedSize.
+struct AttributeVectorHeader {
+  AttributeVectorKind kind;
+  uint32_t width;
+  uint64_t size;
+};
+
+class FileWriter {
+ public:
+  explicit FileWriter(const std::string& file_name) : _stream(file_name, std::ios::binary | std::ios::trunc) {
+    Assert(_stream.is_open(), "save_table: Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    write_array(&value, 1);
+  }
+
+  template <typename T>
+  void write_array(const T* values, const size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as bytes");
+    _stream.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(sizeof(T) * count));
+  }
+
+  void write_string(const std::string& string) {
+    write(static_cast<uint32_t>(string.size()));
+    write_array(string.data(), string.size());
+  }
+
+  // pads the file with zeros up to the next multiple of 8
+  void align() {
+    constexpr char ZEROS[8] = {};
+    write_array(ZEROS, (8 - position() % 8) % 8);
+  }
+
+  uint64_t position() { return static_cast<uint64_t>(_stream.tellp()); }
+
+  void seek(const uint64_t position) { _stream.seekp(static_cast<std::streamoff>(position)); }
+
+  void finish() {
+    _stream.flush();
+    Assert(_stream.good(), "save_table: Could not write the file");
+  }
+
+ protected:
+  std::ofstream _stream;
+};
+
+class FileReader {
+ public:
+  FileReader(const MappedFile& file, const uint64_t position) : _file(file), _position(position) {}
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    std::memcpy(&value, read_array<char>(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  // returns a pointer into the mapped file, which has to be suitably aligned for T
+  template <typename T>
+  const T* read_array(const size_t count) {
+    Assert(_position + sizeof(T) * count <= _file.size(), "mmap_table: file is truncated");
+    const auto* values = reinterpret_cast<const T*>(_file.data() + _position);
+    _position += sizeof(T) * count;
+    return values;
+  }
+
+  std::string read_string() {
+    const auto size = read<uint32_t>();
+    const auto* chars = read_array<char>(size);
+    return std::string{chars, size};
+  }
+
+  void align() { _position += (8 - _position % 8) % 8; }
+
+ protected:
+  const MappedFile& _file;
+  uint64_t _position;
+};
+
+// Values is a std::vector<T>, a pmr_vector<T>, or a std::span<const T>
+template <typename T, typename Values>
+void write_values(FileWriter& writer, const Values& values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto offsets = std::vector<uint32_t>{0};
+    offsets.reserve(values.size() + 1);
+    auto char_count = size_t{0};
+    for (const auto& value : values) {
+      char_count += value.size();
+      Assert(char_count <= std::numeric_limits<uint32_t>::max(), "save_table: strings of a segment exceed 4 GB");
+      offsets.push_back(static_cast<uint32_t>(char_count));
+    }
+    writer.write_array(offsets.data(), offsets.size());
+    for (const auto& value : values) writer.write_array(value.data(), value.size());
+  } else {
+    writer.write_array(values.data(), values.size());
+  }
+  writer.align();
+}
+
+template <typename uintX_t>
+void write_value_ids(FileWriter& writer, const BaseAttributeVector& attribute_vector) {
+  // decoded in blocks, so that the value ids are never materialized as a whole
+  constexpr auto BLOCK_SIZE = size_t{4096};
+  auto value_ids = std::vector<ValueID>(BLOCK_SIZE);
+  auto narrowed_value_ids = std::vector<uintX_t>(BLOCK_SIZE);
+  for (auto begin = size_t{0}; begin < attribute_vector.size(); begin += BLOCK_SIZE) {
+    const auto end = std::min(begin + BLOCK_SIZE, attribute_vector.size());
+    attribute_vector.decode_into(value_ids.data(), begin, end);
+    for (auto index = size_t{0}; index < end - begin; ++index) {
+      narrowed_value_ids[index] = static_cast<uintX_t>(value_ids[index]);
+    }
+    writer.write_array(narrowed_value_ids.data(), end - begin);
+  }
+}
+
+void write_attribute_vector(FileWriter& writer, const BaseAttributeVector& attribute_vector) {
+  const auto size = uint64_t{attribute_vector.size()};
+  if (const auto* bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorHeader{AttributeVectorKind::BitPacked, bit_packed->bit_width(), size});
+    writer.write_array(bit_packed->words().data(), bit_packed->words().size());
+  } else if (const auto* simd_bp128 = dynamic_cast<const SimdBp128AttributeVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorHeader{AttributeVectorKind::SimdBp128, simd_bp128->width(), size});
+    writer.write_array(simd_bp128->references().data(), simd_bp128->references().size());
+    writer.align();
+    writer.write_array(simd_bp128->bit_widths().data(), simd_bp128->bit_widths().size());
+    writer.align();
+    writer.write_array(simd_bp128->words().data(), simd_bp128->words().size());
+  } else {
+    const auto width = attribute_vector.width();
+    writer.write(AttributeVectorHeader{AttributeVectorKind::FixedSize, width, size});
+    switch (width) {
+      case 1:
+        write_value_ids<uint8_t>(writer, attribute_vector);
+        break;
+      case 2:
+        write_value_ids<uint16_t>(writer, attribute_vector);
+        break;
+      default:
+        write_value_ids<uint32_t>(writer, attribute_vector);
+    }
+  }
+  writer.align();
+}
+
+// Writes the first row_count rows of a segment. ValueSegments of chunks with MVCC that are still appended to hold more
+// rows than the chunk, all other segments exactly row_count rows.
+template <typename T>
+void write_segment(FileWriter& writer, const BaseSegment& segment, const ChunkOffset row_count) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    DebugAssert(row_count <= value_segment->size(), "save_table: segment is shorter than its chunk");
+    writer.write(SegmentHeader{SegmentKind::Value, row_count, 0, 0});
+    write_values<T>(writer, std::span<const T>{value_segment->values()}.first(row_count));
+    return;
+  }
+
+  DebugAssert(segment.size() == row_count, "save_table: segment size does not match its chunk");
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    writer.write(SegmentHeader{SegmentKind::Dictionary, row_count, static_cast<uint32_t>(dictionary.size()), 0});
+    if constexpr (std::is_same_v<T, std::string>) {
+      writer.write_array(dictionary.offsets().data(), dictionary.offsets().size());
+      writer.write_array(dictionary.chars().data(), dictionary.chars().size());
+      writer.align();
+    } else {
+      write_values<T>(writer, dictionary);
+    }
+    write_attribute_vector(writer, *dictionary_segment->attribute_vector());
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    const auto& end_positions = *run_length_segment->end_positions();
+    writer.write(SegmentHeader{SegmentKind::RunLength, row_count, static_cast<uint32_t>(end_positions.size()), 0});
+    write_values<T>(writer, *run_length_segment->values());
+    write_values<ChunkOffset>(writer, end_positions);
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    const auto* front_coded_segment = dynamic_cast<const FrontCodedDictionarySegment*>(&segment);
+    Assert(front_coded_segment, "save_table: unsupported segment type");
+    const auto& dictionary = *front_coded_segment->dictionary();
+    writer.write(SegmentHeader{SegmentKind::FrontCodedDictionary, row_count, static_cast<uint32_t>(dictionary.size()),
+                               static_cast<uint32_t>(dictionary.block_size())});
+    writer.write(uint64_t{dictionary.data().size()});
+    write_values<uint32_t>(writer, dictionary.block_offsets());
+    write_values<char>(writer, dictionary.data());
+    write_attribute_vector(writer, *front_coded_segment->attribute_vector());
+  } else if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment);
+    Assert(frame_of_reference_segment, "save_table: unsupported segment type");
+    const auto& block_minima = *frame_of_reference_segment->block_minima();
+    writer.write(
+        SegmentHeader{SegmentKind::FrameOfReference, row_count, static_cast<uint32_t>(block_minima.size()), 0});
+    write_values<T>(writer, block_minima);
+    write_attribute_vector(writer, *frame_of_reference_segment->offsets());
+  } else {
+    Fail("save_table: unsupported segment type");
+  }
+}
+
+// Copies count values in bulk into a Vector, i.e., a pmr_vector<T> or a std::vector<T>. Strings are copied one by one.
+template <typename T, typename Vector = pmr_vector<T>>
+Vector read_values(FileReader& reader, const size_t count) {
+  auto values = Vector{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto* offsets = reader.read_array<uint32_t>(count + 1);
+    const auto* chars = reader.read_array<char>(offsets[count]);
+    values.reserve(count);
+    for (auto index = size_t{0}; index < count; ++index) {
+      values.emplace_back(chars + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+  } else {
+    const auto* begin = reader.read_array<T>(count);
+    values.assign(begin, begin + count);
+  }
+  reader.align();
+  return values;
+}
+
+template <typename T>
+std::shared_ptr<DefaultDictionary<T>> read_dictionary(FileReader& reader, const size_t count) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto* offsets = reader.read_array<uint32_t>(count + 1);
+    const auto* chars = reader.read_array<char>(offsets[count]);
+    reader.align();
+    return std::make_shared<ContiguousStringVector>(pmr_vector<char>(chars, chars + offsets[count]),
+                                                    pmr_vector<uint32_t>(offsets, offsets + count + 1));
+  } else {
+    return std::make_shared<pmr_vector<T>>(read_values<T>(reader, count));
+  }
+}
+
+template <typename uintX_t>
+std::shared_ptr<BaseAttributeVector> map_value_ids(const std::shared_ptr<const MappedFile>& file, FileReader& reader,
+                                                   const size_t count) {
+  return std::make_shared<MappedAttributeVector<uintX_t>>(file, reader.read_array<uintX_t>(count), count);
+}
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(const std::shared_ptr<const MappedFile>& file,
+                                                           FileReader& reader) {
+  const auto header = reader.read<AttributeVectorHeader>();
+  const auto size = static_cast<size_t>(header.size);
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  switch (header.kind) {
+    case AttributeVectorKind::FixedSize:
+      switch (header.width) {
+        case 1:
+          attribute_vector = map_value_ids<uint8_t>(file, reader, size);
+          break;
+        case 2:
+          attribute_vector = map_value_ids<uint16_t>(file, reader, size);
+          break;
+        case 4:
+          attribute_vector = map_value_ids<uint32_t>(file, reader, size);
+          break;
+        default:
+          Fail("mmap_table: invalid value id width");
+      }
+      break;
+    case AttributeVectorKind::BitPacked: {
+      const auto bit_width = static_cast<uint8_t>(header.width);
+      auto words = read_values<uint64_t>(reader, (size * bit_width + 63) / 64);
+      attribute_vector = std::make_shared<BitPackedAttributeVector>(size, bit_width, std::move(words));
+      break;
+    }
+    case AttributeVectorKind::SimdBp128: {
+      const auto block_count = (size + SimdBp128AttributeVector::BLOCK_SIZE - 1) / SimdBp128AttributeVector::BLOCK_SIZE;
+      auto references = read_values<ValueID::base_type>(reader, block_count);
+      auto bit_widths = read_values<uint8_t>(reader, block_count);
+      auto word_count = size_t{0};
+      for (const auto bit_width : bit_widths) word_count += bit_width * SimdBp128AttributeVector::LANE_COUNT;
+      auto words = read_values<uint32_t>(reader, word_count);
+      attribute_vector = std::make_shared<SimdBp128AttributeVector>(
+          size, static_cast<AttributeVectorWidth>(header.width), std::move(references), std::move(bit_widths),
+          std::move(words));
+      break;
+    }
+    default:
+      Fail("mmap_table: unknown attribute vector kind");
+  }
+  reader.align();
+  return attribute_vector;
+}
+
+std::shared_ptr<BaseSegment> read_segment(const std::shared_ptr<const MappedFile>& file, const uint64_t offset,
+                                          const std::string& data_type) {
+  auto reader = FileReader{*file, offset};
+  const auto header = reader.read<SegmentHeader>();
+
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    switch (header.kind) {
+      case SegmentKind::Value:
+        segment = std::make_shared<ValueSegment<Type>>(read_values<Type>(reader, header.size));
+        return;
+      case SegmentKind::Dictionary: {
+        auto dictionary = read_dictionary<Type>(reader, header.entry_count);
+        segment = std::make_shared<DictionarySegment<Type>>(std::move(dictionary), read_attribute_vector(file, reader));
+        return;
+      }
+      case SegmentKind::RunLength: {
+        auto values =
+            std::make_shared<std::vector<Type>>(read_values<Type, std::vector<Type>>(reader, header.entry_count));
+        auto end_positions = std::make_shared<std::vector<ChunkOffset>>(
+            read_values<ChunkOffset, std::vector<ChunkOffset>>(reader, header.entry_count));
+        segment = std::make_shared<RunLengthSegment<Type>>(std::move(values), std::move(end_positions));
+        return;
+      }
+      case SegmentKind::FrontCodedDictionary:
+        if constexpr (std::is_same_v<Type, std::string>) {
+          const auto data_size = reader.read<uint64_t>();
+          const auto block_count = (header.entry_count + header.block_size - 1) / header.block_size;
+          auto block_offsets = read_values<uint32_t, std::vector<uint32_t>>(reader, block_count);
+          auto data = read_values<char, std::vector<char>>(reader, data_size);
+          auto dictionary = std::make_shared<FrontCodedStringVector>(header.entry_count, header.block_size,
+                                                                     std::move(data), std::move(block_offsets));
+          segment =
+              std::make_shared<FrontCodedDictionarySegment>(std::move(dictionary), read_attribute_vector(file, reader));
+          return;
+        }
+        break;
+      case SegmentKind::FrameOfReference:
+        if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+          auto block_minima =
+              std::make_shared<std::vector<Type>>(read_values<Type, std::vector<Type>>(reader, header.entry_count));
+          segment = std::make_shared<FrameOfReferenceSegment<Type>>(std::move(block_minima),
+                                                                    read_attribute_vector(file, reader));
+          return;
+        }
+        break;
+    }
+    Fail("mmap_table: invalid segment kind");
+  });
+  return segment;
+}
+
+}  // namespace
+
+void save_table(const Table& table, const std::string& file_name) {
+  auto writer = FileWriter{file_name};
+  const auto column_count = table.column_count();
+  const auto chunk_count = table.chunk_count();
+
+  auto header = FileHeader{{}, VERSION, table.target_chunk_size(), column_count, chunk_count};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  writer.write(header);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+  }
+  writer.align();
+
+  // the directory holds the size of each chunk followed by the offsets of its segments, which are known only after
+  // the segments are written
+  const auto directory_position = writer.position();
+  auto directory = std::vector<uint64_t>{};
+  directory.reserve(chunk_count * (column_count + 1));
+  writer.seek(directory_position + sizeof(uint64_t) * chunk_count * (column_count + 1));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    // rows appended to a chunk with MVCC in the meantime are not saved
+    const auto row_count = chunk.size();
+    directory.push_back(row_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      writer.align();
+      directory.push_back(writer.position());
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        write_segment<Type>(writer, *chunk.get_segment(column_id), row_count);
+      });
+    }
+  }
+
+  writer.seek(directory_position);
+  writer.write_array(directory.data(), directory.size());
+  writer.finish();
+}
+
+std::shared_ptr<Table> mmap_table(const std::string& file_name) {
+  const auto file = std::make_shared<const MappedFile>(file_name);
+  auto reader = FileReader{*file, 0};
+
+  const auto header = reader.read<FileHeader>();
+  Assert(std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0, "mmap_table: " + file_name + " is not a table file");
+  Assert(header.version == VERSION, "mmap_table: unsupported version of " + file_name);
+
+  const auto table = std::make_shared<Table>(header.target_chunk_size);
+  auto column_types = std::vector<std::string>{};
+  for (auto column_id = ColumnID{0}; column_id < header.column_count; ++column_id) {
+    auto name = reader.read_string();
+    column_types.push_back(reader.read_string());
+    table->add_column_definition(name, column_types.back());
+  }
+  reader.align();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < header.chunk_count; ++chunk_id) {
+    const auto size = reader.read<uint64_t>();
+    const auto* segment_offsets = reader.read_array<uint64_t>(header.column_count);
+    const auto load_segment = [file, segment_offsets, column_types](const ColumnID column_id) {
+      return read_segment(file, segment_offsets[column_id], column_types[column_id]);
+    };
+    auto chunk = Chunk{};
+    chunk.add_lazy_segments(ColumnCount{static_cast<ColumnCount::base_type>(header.column_count)},
+                            static_cast<ChunkOffset>(size), load_segment);
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
+bool is_storable(const BaseSegment& segment, const std::string& data_type) {
+  auto storable = false;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    storable = dynamic_cast<const ValueSegment<Type>*>(&segment) ||
+               dynamic_cast<const DictionarySegment<Type>*>(&segment) ||
+               dynamic_cast<const RunLengthSegment<Type>*>(&segment);
+    if constexpr (std::is_same_v<Type, std::string>) {
+      storable |= dynamic_cast<const FrontCodedDictionarySegment*>(&segment) != nullptr;
+    } else if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+      storable |= dynamic_cast<const FrameOfReferenceSegment<Type>*>(&segment) != nullptr;
+    }
+  });
+  return storable;
+}
+
+std::function<std::shared_ptr<BaseSegment>(ColumnID)> spill_segments(
+    const std::vector<std::shared_ptr<BaseSegment>>& segments, const std::vector<std::string>& column_types,
+    const std::string& file_name) {
+  DebugAssert(!segments.empty() && segments.size() == column_types.size(),
+              "spill_segments: expected one segment per column");
+  auto segment_offsets = std::vector<uint64_t>{};
+  const auto row_count = segments.front()->size();
+  {
+    auto writer = FileWriter{file_name};
+    for (auto column_id = ColumnID{0}; column_id < column_types.size(); ++column_id) {
+      writer.align();
+      segment_offsets.push_back(writer.position());
+      resolve_data_type(column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+        write_segment<Type>(writer, *segments[column_id], row_count);
+      });
+    }
+    writer.finish();
+  }
+
+  // the mapping keeps the contents of the file accessible after it is removed, until the last segment is released
+  const auto file = std::make_shared<const MappedFile>(file_name);
+  std::filesystem::remove(file_name);
+  return [file, segment_offsets = std::move(segment_offsets), column_types](const ColumnID column_id) {
+    return read_segment(file, segment_offsets[column_id], column_types[column_id]);
+  };
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+// Writes a table into a binary file that mirrors its layout: a header with the target chunk size and the column
+// definitions is followed by a directory with the size of each chunk and the file offsets of its segments, and then by
+// the segments themselves. Each segment is stored in the buffers of its encoding, e.g., the runs of a RunLengthSegment
+// or the blocks and attribute vector of a FrontCodedDictionarySegment, so that it is restored with the same type and
+// memory usage.
+void save_table(const Table& table, const std::string& file_name);
+
+// Opens a table written by save_table in time independent of its size. The file is memory-mapped and only the header
+// and the directory are read. A segment is created from the mapped pages when it is accessed for the first time. Only
+// fixed-size value ids are used in place. All other buffers, i.e., plain values, dictionaries, runs, and packed value
+// ids, are copied in bulk, as the segments own them. Strings of ValueSegments are copied one by one. Hence, only the
+// columns that are actually read are ever loaded from disk, but they then take as much memory as before they were
+// saved. The chunks of the returned table cannot be appended to.
+std::shared_ptr<Table> mmap_table(const std::string& file_name);
+
+// Returns whether save_table and spill_segments can store a segment of the given data type, i.e., whether its encoding
+// has a native layout in the file, so that it is restored with the same type and memory usage. ReferenceSegments, for
+// example, cannot be stored.
+bool is_storable(const BaseSegment& segment, const std::string& data_type);
+
+// Writes the segments of an immutable chunk into a file in the same format, e.g., to evict the chunk from memory, and
+// returns a function that creates the segment of a column from the mapped file, as used by Chunk::spill_and_evict.
+// The file is removed right away, its pages stay accessible until the function and all segments created by it are
+// destroyed.
+std::function<std::shared_ptr<BaseSegment>(ColumnID)> spill_segments(
+    const std::vector<std::shared_ptr<BaseSegment>>& segments, const std::vector<std::string>& column_types,
+    const std::string& file_name);
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <utility>
+
+namespace opossum {
+
+WorkerPool::WorkerPool(const size_t thread_count) {
+  // hardware_concurrency() returns 0 if the number of cores is unknown
+  const auto actual_thread_count = std::max(size_t{1}, thread_count);
+  _threads.reserve(actual_thread_count);
+  for (auto thread_index = size_t{0}; thread_index < actual_thread_count; ++thread_index) {
+    _threads.emplace_back([&] { _work(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_jobs_mutex};
+    _shutdown = true;
+  }
+  _jobs_condition.notify_all();
+  for (auto& thread : _threads) thread.join();
+}
+
+std::future<void> WorkerPool::schedule(std::function<void()> job) {
+  auto task = std::packaged_task<void()>{std::move(job)};
+  auto future = task.get_future();
+  {
+    const auto lock = std::lock_guard<std::mutex>{_jobs_mutex};
+    _jobs.push(std::move(task));
+  }
+  _jobs_condition.notify_one();
+  return future;
+}
+
+size_t WorkerPool::thread_count() const { return _threads.size(); }
+
+void WorkerPool::_work() {
+  while (true) {
+    auto task = std::packaged_task<void()>{};
+    {
+      auto lock = std::unique_lock<std::mutex>{_jobs_mutex};
+      _jobs_condition.wait(lock, [&] { return _shutdown || !_jobs.empty(); });
+      if (_jobs.empty()) return;
+      task = std::move(_jobs.front());
+      _jobs.pop();
+    }
+    task();
+  }
+}
+
+}  // namespace opossum
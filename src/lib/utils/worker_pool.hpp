@@ -0,0 +1,36 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A fixed number of threads that execute jobs in the order they were scheduled. Exceptions thrown by a job are
+// rethrown by the get() of its future. The destructor finishes all scheduled jobs before joining the threads.
+class WorkerPool : private Noncopyable {
+ public:
+  explicit WorkerPool(size_t thread_count = std::thread::hardware_concurrency());
+  ~WorkerPool();
+
+  std::future<void> schedule(std::function<void()> job);
+
+  size_t thread_count() const;
+
+ protected:
+  void _work();
+
+  std::vector<std::thread> _threads;
+  std::queue<std::packaged_task<void()>> _jobs;
+  std::mutex _jobs_mutex;
+  std::condition_variable _jobs_condition;
+  bool _shutdown = false;
+};
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/storage/mvcc_data.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class ConcurrencyTransactionContextTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, storage_memory_resource(), UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->append({1});
+    _table->append({2});
+  }
+
+  bool is_visible(const std::shared_ptr<TransactionContext>& transaction_context, const RowID row_id) {
+    return transaction_context->is_visible(*_table->get_chunk(row_id.chunk_id).mvcc_data(), row_id.chunk_offset);
+  }
+
+  std::shared_ptr<TransactionContext> begin() { return TransactionManager::get().new_transaction_context(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ConcurrencyTransactionContextTest, RowsAppendedWithoutTransactionAreVisible) {
+  const auto transaction_context = begin();
+  EXPECT_TRUE(is_visible(transaction_context, RowID{ChunkID{0}, 0}));
+  EXPECT_TRUE(is_visible(transaction_context, RowID{ChunkID{0}, 1}));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, InsertIsVisibleToLaterTransactionsAfterCommit) {
+  const auto inserting_transaction = begin();
+  _table->append({3}, inserting_transaction);
+  const auto row_id = RowID{ChunkID{1}, 0};
+  EXPECT_EQ(_table->row_count(), 3u);
+
+  const auto concurrent_transaction = begin();
+  EXPECT_TRUE(is_visible(inserting_transaction, row_id));
+  EXPECT_FALSE(is_visible(concurrent_transaction, row_id));
+
+  inserting_transaction->commit();
+  EXPECT_EQ(inserting_transaction->phase(), TransactionPhase::Committed);
+  EXPECT_FALSE(is_visible(concurrent_transaction, row_id));
+  EXPECT_TRUE(is_visible(begin(), row_id));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, RolledBackInsertIsInvisible) {
+  {
+    const auto transaction_context = begin();
+    _table->append({3}, transaction_context);
+    transaction_context->rollback();
+    EXPECT_FALSE(is_visible(transaction_context, RowID{ChunkID{1}, 0}));
+  }
+  {
+    // destroying an active transaction rolls it back
+    const auto transaction_context = begin();
+    _table->append({4}, transaction_context);
+  }
+  EXPECT_FALSE(is_visible(begin(), RowID{ChunkID{1}, 0}));
+  EXPECT_FALSE(is_visible(begin(), RowID{ChunkID{1}, 1}));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, Delete) {
+  const auto row_id = RowID{ChunkID{0}, 1};
+  const auto deleting_transaction = begin();
+  const auto concurrent_transaction = begin();
+  EXPECT_TRUE(_table->delete_row(row_id, deleting_transaction));
+  EXPECT_FALSE(is_visible(deleting_transaction, row_id));
+  EXPECT_TRUE(is_visible(concurrent_transaction, row_id));
+
+  // the row is locked by the deleting transaction
+  EXPECT_FALSE(_table->delete_row(row_id, concurrent_transaction));
+
+  deleting_transaction->commit();
+  EXPECT_TRUE(is_visible(concurrent_transaction, row_id));
+  EXPECT_FALSE(is_visible(begin(), row_id));
+  EXPECT_FALSE(_table->delete_row(row_id, begin()));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, RolledBackDeleteKeepsRow) {
+  const auto row_id = RowID{ChunkID{0}, 0};
+  const auto transaction_context = begin();
+  EXPECT_TRUE(_table->delete_row(row_id, transaction_context));
+  transaction_context->rollback();
+
+  const auto next_transaction = begin();
+  EXPECT_TRUE(is_visible(next_transaction, row_id));
+  EXPECT_TRUE(_table->delete_row(row_id, next_transaction));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, DeleteOwnInsert) {
+  const auto transaction_context = begin();
+  _table->append({3}, transaction_context);
+  const auto row_id = RowID{ChunkID{1}, 0};
+  EXPECT_TRUE(_table->delete_row(row_id, transaction_context));
+  EXPECT_FALSE(is_visible(transaction_context, row_id));
+
+  transaction_context->commit();
+  EXPECT_FALSE(is_visible(begin(), row_id));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, OnlyTablesWithMvccCanBeModifiedByTransactions) {
+  auto table = Table{2};
+  table.add_column("a", "int");
+  EXPECT_THROW(table.append({1}, begin()), std::exception);
+  EXPECT_THROW(Table(0, storage_memory_resource(), UseMvcc::Yes), std::exception);
+}
+
+}  // namespace opossum
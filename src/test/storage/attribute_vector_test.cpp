@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/attribute_vector_utils.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/simd_bp128_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageAttributeVectorTest, FixedSizeGetAndSet) {
+  auto attribute_vector = FixedSizeAttributeVector<uint16_t>(3);
+  attribute_vector.set(0, ValueID{7});
+  attribute_vector.set(2, ValueID{65535});
+
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.width(), 2u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{7});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{65535});
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 6u);
+}
+
+TEST_F(StorageAttributeVectorTest, BitPackedValuesSpanningWords) {
+  // 17 bits per value id, so value ids regularly cross the 64-bit word boundaries
+  auto attribute_vector = BitPackedAttributeVector(100, 17);
+  for (auto i = size_t{0}; i < 100; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i * 1297 % 131072)});
+  attribute_vector.set(3, ValueID{131071});
+  attribute_vector.set(3, ValueID{5});
+
+  EXPECT_EQ(attribute_vector.width(), 3u);
+  EXPECT_EQ(attribute_vector.bit_width(), 17u);
+  for (auto i = size_t{0}; i < 100; ++i) {
+    if (i == 3) continue;
+    EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>(i * 1297 % 131072)});
+  }
+  EXPECT_EQ(attribute_vector.get(3), ValueID{5});
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 27 * sizeof(uint64_t));
+}
+
+TEST_F(StorageAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(required_bit_width(0), 1u);
+  EXPECT_EQ(required_bit_width(1), 1u);
+  EXPECT_EQ(required_bit_width(2), 1u);
+  EXPECT_EQ(required_bit_width(3), 2u);
+  EXPECT_EQ(required_bit_width(256), 8u);
+  EXPECT_EQ(required_bit_width(257), 9u);
+}
+
+TEST_F(StorageAttributeVectorTest, MakeAttributeVector) {
+  const auto value_ids = std::vector<ValueID>{ValueID{3}, ValueID{0}, ValueID{2}};
+  EXPECT_EQ(make_attribute_vector(AttributeVectorType::FixedSize, value_ids, 256)->width(), 1u);
+  EXPECT_EQ(make_attribute_vector(AttributeVectorType::FixedSize, value_ids, 257)->width(), 2u);
+  EXPECT_EQ(make_attribute_vector(AttributeVectorType::FixedSize, value_ids, 65537)->width(), 4u);
+  EXPECT_EQ(make_attribute_vector(AttributeVectorType::BitPacked, value_ids, 1000)->width(), 2u);
+
+  for (const auto type : {AttributeVectorType::FixedSize, AttributeVectorType::BitPacked,
+                          AttributeVectorType::SimdBp128}) {
+    const auto attribute_vector = make_attribute_vector(type, value_ids, 4);
+    ASSERT_EQ(attribute_vector->size(), 3u);
+    EXPECT_EQ(attribute_vector->get(0), ValueID{3});
+    EXPECT_EQ(attribute_vector->get(2), ValueID{2});
+  }
+}
+
+TEST_F(StorageAttributeVectorTest, DecodeInto) {
+  auto value_ids = std::vector<ValueID>(1000);
+  for (auto i = size_t{0}; i < value_ids.size(); ++i) value_ids[i] = ValueID{static_cast<uint32_t>(i * 7 % 300)};
+
+  for (const auto type : {AttributeVectorType::FixedSize, AttributeVectorType::BitPacked,
+                          AttributeVectorType::SimdBp128}) {
+    const auto attribute_vector = make_attribute_vector(type, value_ids, 300);
+    auto buffer = std::vector<ValueID>(value_ids.size());
+
+    attribute_vector->decode_into(buffer.data(), 0, value_ids.size());
+    EXPECT_EQ(buffer, value_ids);
+
+    // unaligned ranges within one block and across several blocks
+    attribute_vector->decode_into(buffer.data(), 5, 17);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.begin() + 12, value_ids.begin() + 5));
+    attribute_vector->decode_into(buffer.data(), 100, 999);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.begin() + 899, value_ids.begin() + 100));
+  }
+}
+
+TEST_F(StorageAttributeVectorTest, SimdBp128PacksBlocksRelativeToTheirMinimum) {
+  // 128 equal values, 128 values within a range of 16 above 1000, and an incomplete block of 44 with a range of 2**20
+  auto value_ids = std::vector<ValueID>(300, ValueID{7});
+  for (auto i = size_t{128}; i < 256; ++i) value_ids[i] = ValueID{static_cast<uint32_t>(1000 + i % 16)};
+  for (auto i = size_t{256}; i < 300; ++i) value_ids[i] = ValueID{static_cast<uint32_t>(i % 2 ? 1 << 20 : 0)};
+
+  const auto attribute_vector = SimdBp128AttributeVector{value_ids};
+  EXPECT_EQ(attribute_vector.size(), 300u);
+  EXPECT_EQ(attribute_vector.width(), 3u);
+  for (auto i = size_t{0}; i < value_ids.size(); ++i) EXPECT_EQ(attribute_vector.get(i), value_ids[i]);
+
+  auto block = std::vector<ValueID>(SimdBp128AttributeVector::BLOCK_SIZE);
+  attribute_vector.decode_block(1, block.data());
+  EXPECT_TRUE(std::equal(block.begin(), block.end(), value_ids.begin() + 128));
+
+  // 0 bits for the first block, 4 bits for the second, and 21 bits for the last block - 4 words per bit
+  const auto expected_words = (0 + 4 + 21) * 4;
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(),
+            expected_words * sizeof(uint32_t) + 3 * (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(size_t)));
+
+  EXPECT_THROW(SimdBp128AttributeVector{value_ids}.set(0, ValueID{1}), std::exception);
+}
+
+}  // namespace opossum
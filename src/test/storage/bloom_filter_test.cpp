@@ -0,0 +1,38 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/bloom_filter.hpp"
+#include "utils/hash.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1000};
+  for (auto value = 0; value < 1000; ++value) bloom_filter.insert(mixed_hash(value * 7919));
+  for (auto value = 0; value < 1000; ++value) EXPECT_TRUE(bloom_filter.may_contain(mixed_hash(value * 7919)));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto bloom_filter = BloomFilter{10000};
+  for (auto value = 0; value < 10000; ++value) bloom_filter.insert(mixed_hash(std::to_string(value)));
+
+  auto false_positives = 0;
+  for (auto value = 10000; value < 20000; ++value) {
+    if (bloom_filter.may_contain(mixed_hash(std::to_string(value)))) ++false_positives;
+  }
+  // about one percent is expected with ten bits per value
+  EXPECT_LT(false_positives, 300);
+}
+
+TEST_F(StorageBloomFilterTest, Size) {
+  EXPECT_EQ(BloomFilter{0}.block_count(), 1u);
+  EXPECT_EQ(BloomFilter{1000}.block_count(), 40u);
+  EXPECT_EQ(BloomFilter{1000}.estimate_memory_usage(), 40u * 32u);
+  EXPECT_EQ(BloomFilter(1000, 16).block_count(), 63u);
+}
+
+}  // namespace opossum
@@ -6,56 +6,171 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/group_key_index.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
 
-// class StorageChunkTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     int_value_segment = std::make_shared<ValueSegment<int32_t>>();
-//     int_value_segment->append(4);
-//     int_value_segment->append(6);
-//     int_value_segment->append(3);
-
-//     string_value_segment = std::make_shared<ValueSegment<std::string>>();
-//     string_value_segment->append("Hello,");
-//     string_value_segment->append("world");
-//     string_value_segment->append("!");
-//   }
-
-//   Chunk c;
-//   std::shared_ptr<BaseSegment> int_value_segment = nullptr;
-//   std::shared_ptr<BaseSegment> string_value_segment = nullptr;
-// };
-
-// TEST_F(StorageChunkTest, AddSegmentToChunk) {
-//   EXPECT_EQ(c.size(), 0u);
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   EXPECT_EQ(c.size(), 3u);
-// }
-
-// TEST_F(StorageChunkTest, AddValuesToChunk) {
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   c.append({2, "two"});
-//   EXPECT_EQ(c.size(), 4u);
-
-//   if constexpr (HYRISE_DEBUG) {
-//     EXPECT_THROW(c.append({}), std::exception);
-//     EXPECT_THROW(c.append({4, "val", 3}), std::exception);
-//     EXPECT_EQ(c.size(), 4u);
-//   }
-// }
-
-// TEST_F(StorageChunkTest, RetrieveSegment) {
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   c.append({2, "two"});
-
-//   auto base_segment = c.get_segment(ColumnID{0});
-//   EXPECT_EQ(base_segment->size(), 4u);
-// }
+class StorageChunkTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    int_value_segment = std::make_shared<ValueSegment<int32_t>>();
+    int_value_segment->append(4);
+    int_value_segment->append(6);
+    int_value_segment->append(3);
+
+    string_value_segment = std::make_shared<ValueSegment<std::string>>();
+    string_value_segment->append("Hello,");
+    string_value_segment->append("world");
+    string_value_segment->append("!");
+  }
+
+  Chunk c;
+  std::shared_ptr<BaseSegment> int_value_segment = nullptr;
+  std::shared_ptr<BaseSegment> string_value_segment = nullptr;
+};
+
+TEST_F(StorageChunkTest, AddSegmentToChunk) {
+  EXPECT_EQ(c.size(), 0u);
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_EQ(c.size(), 3u);
+}
+
+TEST_F(StorageChunkTest, AddValuesToChunk) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append({2, "two"});
+  EXPECT_EQ(c.size(), 4u);
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(c.append({}), std::exception);
+    EXPECT_THROW(c.append({4, "val", 3}), std::exception);
+    EXPECT_EQ(c.size(), 4u);
+  }
+}
+
+TEST_F(StorageChunkTest, AppendColumns) {
+  c.add_segment(std::make_shared<ValueSegment<int32_t>>());
+  c.add_segment(std::make_shared<ValueSegment<std::string>>());
+  c.append_columns({int_value_segment, string_value_segment}, 1, 3);
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[0], AllTypeVariant{6});
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[1], AllTypeVariant{"!"});
+
+  EXPECT_THROW(c.append_columns({string_value_segment, int_value_segment}, 0, 1), std::exception);
+}
+
+TEST_F(StorageChunkTest, RetrieveSegment) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append({2, "two"});
+
+  auto base_segment = c.get_segment(ColumnID{0});
+  EXPECT_EQ(base_segment->size(), 4u);
+}
+
+TEST_F(StorageChunkTest, AddAndGetIndexes) {
+  c.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_value_segment));
+  c.add_segment(std::make_shared<DictionarySegment<std::string>>(string_value_segment));
+  EXPECT_TRUE(c.get_indexes({ColumnID{0}}).empty());
+
+  const auto index = std::make_shared<GroupKeyIndex>(c.get_segment(ColumnID{1}));
+  c.add_index(index);
+  EXPECT_TRUE(c.get_indexes({ColumnID{0}}).empty());
+  EXPECT_TRUE(c.get_indexes({ColumnID{1}, ColumnID{0}}).empty());
+  EXPECT_EQ(c.get_indexes({ColumnID{1}}), (std::vector<std::shared_ptr<BaseIndex>>{index}));
+}
+
+TEST_F(StorageChunkTest, ReplaceSegments) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.add_index(std::make_shared<GroupKeyIndex>(std::make_shared<DictionarySegment<int32_t>>(int_value_segment)));
+
+  const auto old_segment = c.get_segment(ColumnID{0});
+  c.replace_segments({std::make_shared<DictionarySegment<int32_t>>(int_value_segment),
+                      std::make_shared<DictionarySegment<std::string>>(string_value_segment)},
+                     {nullptr, nullptr});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(c.get_segment(ColumnID{0})));
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_TRUE(c.get_indexes({ColumnID{0}}).empty());
+
+  // readers that still hold the previous segment are not affected
+  EXPECT_EQ((*old_segment)[2], AllTypeVariant{3});
+
+  // indexes on segments that stay in place are kept
+  const auto index = std::make_shared<GroupKeyIndex>(c.get_segment(ColumnID{0}));
+  c.add_index(index);
+  c.replace_segments({c.get_segment(ColumnID{0}), string_value_segment}, {nullptr, nullptr});
+  EXPECT_EQ(c.get_indexes({ColumnID{0}}), (std::vector<std::shared_ptr<BaseIndex>>{index}));
+
+  EXPECT_THROW(c.replace_segments({int_value_segment}, {nullptr}), std::exception);
+
+  // segments that were replaced in the meantime are not overwritten
+  EXPECT_FALSE(c.replace_segments_if_unchanged({int_value_segment, string_value_segment},
+                                               {int_value_segment, string_value_segment}, {}));
+  EXPECT_EQ(c.get_indexes({ColumnID{0}}).size(), 1u);
+  EXPECT_TRUE(c.replace_segments_if_unchanged({c.get_segment(ColumnID{0}), string_value_segment},
+                                              {int_value_segment, string_value_segment}, {}));
+  EXPECT_EQ(c.get_segment(ColumnID{0}), int_value_segment);
+  EXPECT_TRUE(c.get_indexes({ColumnID{0}}).empty());
+}
+
+TEST_F(StorageChunkTest, Evict) {
+  c.add_segment(int_value_segment);
+  EXPECT_FALSE(c.is_evictable());
+
+  c.replace_segments({std::make_shared<DictionarySegment<int32_t>>(int_value_segment)}, {});
+  EXPECT_TRUE(c.is_evictable());
+  EXPECT_FALSE(c.test_and_clear_accessed());
+
+  // a segment held outside of the chunk pins it
+  auto segment = c.get_segment(ColumnID{0});
+  EXPECT_TRUE(c.test_and_clear_accessed());
+  EXPECT_FALSE(c.evict([&](const ColumnID) { return segment; }));
+  const auto memory_usage = c.memory_usage();
+  EXPECT_GT(memory_usage, 0u);
+
+  segment = nullptr;
+  auto load_count = 0;
+  EXPECT_TRUE(c.evict([&](const ColumnID) {
+    ++load_count;
+    return std::make_shared<DictionarySegment<int32_t>>(int_value_segment);
+  }));
+  EXPECT_EQ(c.memory_usage(), 0u);
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_EQ(c.memory_usage(), memory_usage);
+  EXPECT_EQ(load_count, 1);
+}
+
+TEST_F(StorageChunkTest, SpillAndEvict) {
+  c.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_value_segment));
+  auto spill_count = 0;
+  const auto spill = [&](const std::vector<std::shared_ptr<BaseSegment>>& segments) {
+    ++spill_count;
+    const auto segment = segments[0];
+    return std::function<std::shared_ptr<BaseSegment>(ColumnID)>{[segment](const ColumnID) { return segment; }};
+  };
+
+  // nothing is spilled for pinned chunks
+  auto segment = c.get_segment(ColumnID{0});
+  EXPECT_TRUE(c.test_and_clear_accessed());
+  EXPECT_FALSE(c.spill_and_evict(spill));
+  EXPECT_EQ(spill_count, 0);
+
+  // the chunk is kept if spill returns no loader
+  segment = nullptr;
+  EXPECT_FALSE(c.spill_and_evict([](const auto&) { return std::function<std::shared_ptr<BaseSegment>(ColumnID)>{}; }));
+  EXPECT_GT(c.memory_usage(), 0u);
+
+  // spilling does not mark the chunk as accessed
+  EXPECT_TRUE(c.spill_and_evict(spill));
+  EXPECT_EQ(spill_count, 1);
+  EXPECT_FALSE(c.test_and_clear_accessed());
+  EXPECT_EQ(c.memory_usage(), 0u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+}
 
 }  // namespace opossum
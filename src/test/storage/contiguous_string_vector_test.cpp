@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/contiguous_string_vector.hpp"
+
+namespace opossum {
+
+class StorageContiguousStringVectorTest : public BaseTest {
+ protected:
+  ContiguousStringVector strings{std::vector<std::string>{"Alexander", "", "Bill", "Hasso"}};
+};
+
+TEST_F(StorageContiguousStringVectorTest, Access) {
+  EXPECT_EQ(strings.size(), 4u);
+  EXPECT_FALSE(strings.empty());
+  EXPECT_EQ(strings[0], "Alexander");
+  EXPECT_EQ(strings[1], "");
+  EXPECT_EQ(strings[3], "Hasso");
+
+  // all strings share one buffer
+  EXPECT_EQ(strings[0].data() + strings[0].size(), strings[2].data());
+
+  EXPECT_TRUE(ContiguousStringVector{}.empty());
+}
+
+TEST_F(StorageContiguousStringVectorTest, Iterators) {
+  const auto sorted = ContiguousStringVector{std::vector<std::string>{"a", "bb", "bc", "d"}};
+  EXPECT_EQ(std::distance(sorted.cbegin(), sorted.cend()), 4);
+  EXPECT_EQ(*(sorted.begin() + 2), "bc");
+  EXPECT_EQ(std::lower_bound(sorted.cbegin(), sorted.cend(), std::string{"bc"}) - sorted.cbegin(), 2);
+  EXPECT_EQ(std::upper_bound(sorted.cbegin(), sorted.cend(), std::string{"c"}) - sorted.cbegin(), 3);
+}
+
+TEST_F(StorageContiguousStringVectorTest, MemoryUsage) {
+  EXPECT_EQ(strings.estimate_memory_usage(), 18 * sizeof(char) + 5 * sizeof(uint32_t));
+}
+
+}  // namespace opossum
@@ -6,67 +6,153 @@
 
 #include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/simd_bp128_attribute_vector.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
 
-// class StorageDictionarySegmentTest : public BaseTest {
-//  protected:
-//   std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
-//   std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
-// };
-
-// TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
-//   vc_str->append("Bill");
-//   vc_str->append("Steve");
-//   vc_str->append("Alexander");
-//   vc_str->append("Steve");
-//   vc_str->append("Hasso");
-//   vc_str->append("Bill");
-
-//   std::shared_ptr<BaseSegment> col;
-//   resolve_data_type("string", [&](auto type) {
-//     using Type = typename decltype(type)::type;
-//     col = std::make_shared<DictionarySegment<Type>>(vc_str);
-//   });
-
-//   auto dict_col = std::dynamic_pointer_cast<DictionarySegment<std::string>>(col);
-
-//   // Test attribute_vector size
-//   EXPECT_EQ(dict_col->size(), 6u);
-
-//   // Test dictionary size (uniqueness)
-//   EXPECT_EQ(dict_col->unique_values_count(), 4u);
-
-//   // Test sorting
-//   auto dict = dict_col->dictionary();
-//   EXPECT_EQ((*dict)[0], "Alexander");
-//   EXPECT_EQ((*dict)[1], "Bill");
-//   EXPECT_EQ((*dict)[2], "Hasso");
-//   EXPECT_EQ((*dict)[3], "Steve");
-// }
-
-// TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
-//   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
-
-//   std::shared_ptr<BaseSegment> col;
-//   resolve_data_type("int", [&](auto type) {
-//     using Type = typename decltype(type)::type;
-//     col = std::make_shared<DictionarySegment<Type>>(vc_int);
-//   });
-//   auto dict_col = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
-
-//   EXPECT_EQ(dict_col->lower_bound(4), (ValueID)2);
-//   EXPECT_EQ(dict_col->upper_bound(4), (ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(5), (ValueID)3);
-//   EXPECT_EQ(dict_col->upper_bound(5), (ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(15), INVALID_VALUE_ID);
-//   EXPECT_EQ(dict_col->upper_bound(15), INVALID_VALUE_ID);
-// }
-
-// TODO(student): You should add some more tests here (full coverage would be appreciated) and possibly in other files.
+class StorageDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  std::shared_ptr<BaseSegment> col;
+  resolve_data_type("string", [&](auto type) {
+    using Type = typename decltype(type)::type;
+    col = std::make_shared<DictionarySegment<Type>>(vc_str);
+  });
+
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+}
+
+TEST_F(StorageDictionarySegmentTest, StringDictionaryIsContiguous) {
+  vc_str->append("Steve");
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  auto dict_col = DictionarySegment<std::string>{vc_str};
+
+  const std::string_view value = dict_col.value_by_value_id(ValueID{1});
+  EXPECT_EQ(value, "Steve");
+  EXPECT_EQ(dict_col.get(0), "Steve");
+  EXPECT_EQ(dict_col.lower_bound(std::string{"C"}), ValueID{1});
+  EXPECT_EQ(dict_col.upper_bound(AllTypeVariant{"Bill"}), ValueID{1});
+
+  // 9 characters, 3 offsets, and 3 one-byte value ids
+  EXPECT_EQ(dict_col.estimate_memory_usage(), 9 + 3 * sizeof(uint32_t) + 3);
+}
+
+TEST_F(StorageDictionarySegmentTest, FrontCodedDictionary) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  auto dict_col = FrontCodedDictionarySegment{vc_str};
+
+  EXPECT_EQ(dict_col.unique_values_count(), 3u);
+  EXPECT_EQ(dict_col.get(0), "Bill");
+  EXPECT_EQ(dict_col[3], AllTypeVariant{"Steve"});
+  EXPECT_EQ(dict_col.value_by_value_id(ValueID{0}), "Alexander");
+  EXPECT_EQ(dict_col.lower_bound(std::string{"Bill"}), ValueID{1});
+  EXPECT_EQ(dict_col.upper_bound(std::string{"Bill"}), ValueID{2});
+  EXPECT_EQ(dict_col.upper_bound(std::string{"Steve"}), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+
+  std::shared_ptr<BaseSegment> col;
+  resolve_data_type("int", [&](auto type) {
+    using Type = typename decltype(type)::type;
+    col = std::make_shared<DictionarySegment<Type>>(vc_int);
+  });
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), (ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(4), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(5), (ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(5), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(15), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionarySegmentTest, AttributeVectorWidthFollowsUniqueValuesCount) {
+  for (auto i = 0; i < 256; ++i) vc_int->append(i);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 1u);
+
+  vc_int->append(256);
+  dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 2u);
+
+  for (auto i = 257; i <= (1 << 16); ++i) vc_int->append(i);
+  dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 4u);
+  EXPECT_EQ(dict_col->get((1 << 16)), (1 << 16));
+}
+
+TEST_F(StorageDictionarySegmentTest, BitPackedAttributeVector) {
+  for (auto i = 0; i < 100; ++i) vc_int->append(i % 5);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int, AttributeVectorType::BitPacked);
+
+  const auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->bit_width(), 3u);
+  for (auto i = 0; i < 100; ++i) EXPECT_EQ(dict_col->get(i), i % 5);
+
+  // 100 values with 3 bits each fit into five 64-bit words
+  EXPECT_EQ(dict_col->estimate_memory_usage(), 5 * sizeof(int) + 5 * sizeof(uint64_t));
+}
+
+TEST_F(StorageDictionarySegmentTest, SimdBp128AttributeVector) {
+  for (auto i = 0; i < 1000; ++i) vc_int->append(i / 10);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int, AttributeVectorType::SimdBp128);
+
+  ASSERT_TRUE(std::dynamic_pointer_cast<const SimdBp128AttributeVector>(dict_col->attribute_vector()));
+  for (auto i = 0; i < 1000; ++i) EXPECT_EQ(dict_col->get(i), i / 10);
+  // sorted value ids need 4 bits per row (at most 14 distinct values per block) instead of 8 bits for 100 values
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 1u);
+  EXPECT_LT(dict_col->attribute_vector()->estimate_memory_usage(), 1000u * 5 / 8);
+}
+
+TEST_F(StorageDictionarySegmentTest, AccessAndImmutability) {
+  vc_int->append(3);
+  vc_int->append(1);
+  vc_int->append(3);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+
+  EXPECT_EQ((*dict_col)[0], AllTypeVariant{3});
+  EXPECT_EQ(dict_col->get(1), 1);
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{1}), 3);
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{2}), ValueID{1});
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{3}), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->estimate_memory_usage(), 2 * sizeof(int) + 3 * sizeof(uint8_t));
+  EXPECT_THROW(dict_col->append(4), std::exception);
+}
 
 }  // namespace opossum
@@ -0,0 +1,81 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  // checks that the estimate of the chosen encoding is within 25% of the actual memory usage
+  static void expect_accurate_estimate(const std::string& data_type, const std::shared_ptr<BaseSegment>& segment,
+                                       const EncodingAdvice& advice) {
+    const auto actual_memory_usage = encode_segment(advice.spec, data_type, segment)->estimate_memory_usage();
+    EXPECT_NEAR(static_cast<double>(advice.estimated_memory_usage), static_cast<double>(actual_memory_usage),
+                0.25 * static_cast<double>(actual_memory_usage));
+  }
+};
+
+TEST_F(StorageEncodingAdvisorTest, SortedValuesUseRunLength) {
+  auto segment = std::make_shared<ValueSegment<int>>();
+  for (auto i = 0; i < 50000; ++i) segment->append(i / 100);
+
+  const auto advice = advise_encoding("int", *segment);
+  EXPECT_EQ(advice.spec.encoding_type, EncodingType::RunLength);
+  expect_accurate_estimate("int", segment, advice);
+}
+
+TEST_F(StorageEncodingAdvisorTest, FewDistinctValuesUseDictionary) {
+  // 200 distinct values fit into one byte per value id
+  auto segment = std::make_shared<ValueSegment<int>>();
+  for (auto i = 0; i < 50000; ++i) segment->append((i * 7919) % 200 * 1000);
+
+  const auto advice = advise_encoding("int", *segment);
+  EXPECT_EQ(advice.spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(advice.spec.attribute_vector_type, AttributeVectorType::FixedSize);
+  expect_accurate_estimate("int", segment, advice);
+}
+
+TEST_F(StorageEncodingAdvisorTest, NarrowValueIdsAreBitPacked) {
+  // 1000 distinct values need ten bits per value id instead of two bytes
+  auto segment = std::make_shared<ValueSegment<double>>();
+  for (auto i = 0; i < 50000; ++i) segment->append(static_cast<double>((i * 7919) % 1000) / 3.0);
+
+  const auto advice = advise_encoding("double", *segment);
+  EXPECT_EQ(advice.spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(advice.spec.attribute_vector_type, AttributeVectorType::BitPacked);
+  expect_accurate_estimate("double", segment, advice);
+}
+
+TEST_F(StorageEncodingAdvisorTest, UniqueIntegersUseFrameOfReference) {
+  auto segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto i = int64_t{0}; i < 50000; ++i) segment->append((int64_t{1} << 40) + i * 3 + (i * 7919) % 64);
+
+  const auto advice = advise_encoding("long", *segment);
+  EXPECT_EQ(advice.spec.encoding_type, EncodingType::FrameOfReference);
+  expect_accurate_estimate("long", segment, advice);
+}
+
+TEST_F(StorageEncodingAdvisorTest, SharedPrefixesUseFrontCoding) {
+  auto segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto i = 0; i < 20000; ++i) {
+    segment->append("https://example.com/products/electronics/item/" + std::to_string(100000 + (i * 7919) % 20000));
+  }
+
+  const auto advice = advise_encoding("string", *segment);
+  EXPECT_EQ(advice.spec.encoding_type, EncodingType::FrontCodedDictionary);
+  expect_accurate_estimate("string", segment, advice);
+}
+
+TEST_F(StorageEncodingAdvisorTest, RequiresValueSegment) {
+  auto segment = std::make_shared<ValueSegment<int>>();
+  segment->append(1);
+  EXPECT_THROW(advise_encoding("int", *encode_segment(EncodingType::Dictionary, "int", segment)), std::exception);
+}
+
+}  // namespace opossum
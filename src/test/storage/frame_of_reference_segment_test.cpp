@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/simd_bp128_attribute_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  for (auto value : {-5, 10, 3, -5}) vc_int->append(value);
+  auto segment = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_EQ(*segment.block_minima(), std::vector<int32_t>{-5});
+  EXPECT_EQ(segment.get(0), -5);
+  EXPECT_EQ(segment.get(1), 10);
+  EXPECT_EQ(segment[2], AllTypeVariant{3});
+
+  // the largest offset is 15, which needs 4 bits
+  const auto offsets = std::dynamic_pointer_cast<const SimdBp128AttributeVector>(segment.offsets());
+  ASSERT_TRUE(offsets);
+  EXPECT_EQ(offsets->bit_widths(), pmr_vector<uint8_t>{4});
+  EXPECT_EQ(segment.estimate_memory_usage(), sizeof(int32_t) + offsets->estimate_memory_usage());
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, BlocksHaveTheirOwnMinimum) {
+  const auto block_size = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  const auto base = int64_t{1} << 40;
+  for (auto i = ChunkOffset{0}; i < 2 * block_size + 10; ++i) vc_long->append(base * (i / block_size) + i % 7);
+  auto segment = FrameOfReferenceSegment<int64_t>{vc_long};
+
+  EXPECT_EQ(*segment.block_minima(), (std::vector<int64_t>{0, base, 2 * base}));
+  for (auto i = ChunkOffset{0}; i < segment.size(); ++i) EXPECT_EQ(segment.get(i), base * (i / block_size) + i % 7);
+  const auto& bit_widths = std::dynamic_pointer_cast<const SimdBp128AttributeVector>(segment.offsets())->bit_widths();
+  EXPECT_TRUE(std::all_of(bit_widths.cbegin(), bit_widths.cend(), [](const auto bit_width) { return bit_width <= 3; }));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, WideBlockDoesNotWidenOtherBlocks) {
+  const auto block_size = FrameOfReferenceSegment<int32_t>::BLOCK_SIZE;
+  const auto value = [&](const ChunkOffset i) { return static_cast<int32_t>(i < block_size ? i % 2 : i * 1000); };
+  for (auto i = ChunkOffset{0}; i < 2 * block_size; ++i) vc_int->append(value(i));
+  auto segment = FrameOfReferenceSegment<int32_t>{vc_int};
+
+  for (auto i = ChunkOffset{0}; i < segment.size(); ++i) EXPECT_EQ(segment.get(i), value(i));
+  const auto& bit_widths = std::dynamic_pointer_cast<const SimdBp128AttributeVector>(segment.offsets())->bit_widths();
+  EXPECT_EQ(bit_widths.front(), 1u);
+  EXPECT_GT(bit_widths.back(), 10u);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, FullValueRange) {
+  vc_int->append(std::numeric_limits<int32_t>::min());
+  vc_int->append(std::numeric_limits<int32_t>::max());
+  auto segment = FrameOfReferenceSegment<int32_t>{vc_int};
+  EXPECT_EQ(segment.get(0), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(segment.get(1), std::numeric_limits<int32_t>::max());
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, WideBlocksFallBackToDictionaryEncoding) {
+  // nanosecond timestamps one second apart: a block spans about 2^41 ns
+  const auto start = int64_t{1'600'000'000'000'000'000};
+  const auto timestamp = [&](const ChunkOffset i) { return start + int64_t{1'000'000'000} * i; };
+  auto table = Table{3000};
+  table.add_column("timestamp", "long");
+  for (auto i = ChunkOffset{0}; i < 3000; ++i) table.append({timestamp(i)});
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<int64_t>>(
+      table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_FALSE(FrameOfReferenceSegment<int64_t>::is_encodable(*value_segment));
+  EXPECT_TRUE(FrameOfReferenceSegment<int64_t>::is_encodable(*vc_long));
+
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<int64_t>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+  for (auto i = ChunkOffset{0}; i < 3000; ++i) EXPECT_EQ(dictionary_segment->get(i), timestamp(i));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, RejectsUnsuitableSegments) {
+  vc_long->append(int64_t{0});
+  vc_long->append(int64_t{1} << 33);
+  EXPECT_THROW(FrameOfReferenceSegment<int64_t>{vc_long}, std::exception);
+  EXPECT_THROW(FrameOfReferenceSegment<int32_t>{vc_long}, std::exception);
+
+  const auto vc_str = std::make_shared<ValueSegment<std::string>>();
+  EXPECT_THROW(encode_segment(EncodingType::FrameOfReference, "string", vc_str), std::exception);
+  EXPECT_THROW(FrameOfReferenceSegment<int32_t>{vc_int}.append(1), std::exception);
+}
+
+}  // namespace opossum
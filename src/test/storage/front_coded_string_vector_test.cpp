@@ -0,0 +1,66 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_string_vector.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedStringVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 50; ++i) {
+      values.push_back("https://example.com/path/" + std::to_string(100 + i * 2));
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFrontCodedStringVectorTest, Access) {
+  const auto strings = FrontCodedStringVector{values, 4};
+  EXPECT_EQ(strings.size(), 50u);
+  EXPECT_EQ(strings.block_size(), 4u);
+  for (auto i = size_t{0}; i < values.size(); ++i) EXPECT_EQ(strings[i], values[i]);
+}
+
+TEST_F(StorageFrontCodedStringVectorTest, LowerAndUpperBound) {
+  const auto strings = FrontCodedStringVector{values, 4};
+  // before the first, between, equal to, and after the last string - including block heads
+  EXPECT_EQ(strings.lower_bound("a"), 0u);
+  EXPECT_EQ(strings.upper_bound("a"), 0u);
+  EXPECT_EQ(strings.lower_bound(values[0]), 0u);
+  EXPECT_EQ(strings.upper_bound(values[0]), 1u);
+  EXPECT_EQ(strings.lower_bound(values[4]), 4u);
+  EXPECT_EQ(strings.upper_bound(values[4]), 5u);
+  EXPECT_EQ(strings.lower_bound(values[7]), 7u);
+  EXPECT_EQ(strings.upper_bound(values[7]), 8u);
+  EXPECT_EQ(strings.lower_bound("https://example.com/path/107"), 4u);
+  EXPECT_EQ(strings.upper_bound("https://example.com/path/107"), 4u);
+  EXPECT_EQ(strings.lower_bound(values[49]), 49u);
+  EXPECT_EQ(strings.upper_bound(values[49]), 50u);
+  EXPECT_EQ(strings.lower_bound("z"), 50u);
+}
+
+TEST_F(StorageFrontCodedStringVectorTest, CompressesCommonPrefixes) {
+  auto total_length = size_t{0};
+  for (const auto& value : values) total_length += value.size();
+
+  const auto strings = FrontCodedStringVector{values};
+  EXPECT_LT(strings.estimate_memory_usage(), total_length / 2);
+}
+
+TEST_F(StorageFrontCodedStringVectorTest, LongAndEmptyStrings) {
+  const auto long_string = std::string(1000, 'x');
+  const auto strings = FrontCodedStringVector{{"", long_string, long_string + "y"}, 2};
+  EXPECT_EQ(strings[0], "");
+  EXPECT_EQ(strings[1], long_string);
+  EXPECT_EQ(strings[2], long_string + "y");
+  EXPECT_EQ(strings.lower_bound(long_string + "a"), 2u);
+  EXPECT_EQ(FrontCodedStringVector{{}}.size(), 0u);
+  EXPECT_EQ(FrontCodedStringVector{{}}.lower_bound("a"), 0u);
+}
+
+}  // namespace opossum
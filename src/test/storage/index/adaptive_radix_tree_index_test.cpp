@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      vc_str->append(value);
+    }
+    dict_segment = std::make_shared<DictionarySegment<std::string>>(vc_str);
+    index = std::make_shared<AdaptiveRadixTreeIndex>(dict_segment);
+  }
+
+  // returns the offsets in [begin, end) in ascending order
+  static std::vector<ChunkOffset> offsets(const std::pair<BaseIndex::Iterator, BaseIndex::Iterator>& range) {
+    auto result = std::vector<ChunkOffset>(range.first, range.second);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+  std::shared_ptr<DictionarySegment<std::string>> dict_segment;
+  std::shared_ptr<AdaptiveRadixTreeIndex> index;
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, Equals) {
+  EXPECT_EQ(offsets(index->equals({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->equals({"apple"})), (std::vector<ChunkOffset>{4}));
+  EXPECT_EQ(offsets(index->equals({"inbox"})), (std::vector<ChunkOffset>{7}));
+  EXPECT_TRUE(offsets(index->equals({"bravo"})).empty());
+  EXPECT_TRUE(offsets(index->equals({"zulu"})).empty());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, LowerAndUpperBound) {
+  EXPECT_EQ(index->lower_bound({"aardvark"}), index->cbegin());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+  EXPECT_EQ(offsets({index->cbegin(), index->lower_bound({"delta"})}), (std::vector<ChunkOffset>{4, 5, 6}));
+  EXPECT_EQ(offsets({index->upper_bound({"delta"}), index->cend()}), (std::vector<ChunkOffset>{0, 2, 7}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, AllNodeTypes) {
+  // the number of distinct values determines the fanout of the nodes: 3 -> Node4, 10 -> Node16, 40 -> Node48,
+  // 300 -> Node4 with two Node256 and Node48 children, 808 -> Node4 with Node256 and Node48 children
+  for (const auto distinct_count : {3, 10, 40, 300, 808}) {
+    auto values = std::make_shared<ValueSegment<int64_t>>();
+    for (auto value = int64_t{0}; value < distinct_count; ++value) {
+      values->append(value * value * 1000);
+      if (value % 7 == 0) values->append(value * value * 1000);
+    }
+    const auto segment = std::make_shared<DictionarySegment<int64_t>>(values);
+    const auto art_index = AdaptiveRadixTreeIndex{segment};
+    const auto group_key_index = GroupKeyIndex{segment};
+
+    // search for each value, the values next to it, and values outside of the range
+    for (auto value = int64_t{-1}; value <= distinct_count; ++value) {
+      for (const auto search_value : {value * value * 1000 - 1, value * value * 1000, value * value * 1000 + 1}) {
+        EXPECT_EQ(art_index.lower_bound({search_value}) - art_index.cbegin(),
+                  group_key_index.lower_bound({search_value}) - group_key_index.cbegin());
+        EXPECT_EQ(art_index.upper_bound({search_value}) - art_index.cbegin(),
+                  group_key_index.upper_bound({search_value}) - group_key_index.cbegin());
+      }
+    }
+    EXPECT_EQ(offsets(art_index.equals({int64_t{0}})).size(), 2u);
+    EXPECT_GT(art_index.estimate_memory_usage(), sizeof(ChunkOffset) * values->size());
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto empty_index = AdaptiveRadixTreeIndex{
+      std::make_shared<DictionarySegment<std::string>>(std::make_shared<ValueSegment<std::string>>())};
+  EXPECT_EQ(empty_index.lower_bound({"a"}), empty_index.cend());
+  EXPECT_EQ(empty_index.cbegin(), empty_index.cend());
+}
+
+}  // namespace opossum
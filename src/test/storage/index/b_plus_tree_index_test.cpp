@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(10);
+    table->add_column("id", "int");
+    table->add_column("name", "string");
+    table->add_column("value", "long");
+    for (auto i = 0; i < 100; ++i) table->append({i % 25, "name" + std::to_string(i % 4), int64_t{i}});
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StorageBPlusTreeIndexTest, BulkLoadAndEquals) {
+  const auto index = table->create_index({ColumnID{0}});
+  EXPECT_EQ(index->size(), 100u);
+  EXPECT_EQ(*index->equals({7}), (PosList{{ChunkID{0}, 7}, {ChunkID{3}, 2}, {ChunkID{5}, 7}, {ChunkID{8}, 2}}));
+  EXPECT_TRUE(index->equals({25})->empty());
+  EXPECT_TRUE(index->equals({-1})->empty());
+}
+
+TEST_F(StorageBPlusTreeIndexTest, MaintainedOnAppend) {
+  const auto index = table->create_index({ColumnID{0}});
+  for (auto i = 0; i < 5000; ++i) table->append({i % 50, "appended", int64_t{i}});
+
+  EXPECT_EQ(index->size(), 5100u);
+  EXPECT_GT(index->height(), 2u);
+  EXPECT_EQ(index->equals({7})->size(), 104u);
+  EXPECT_EQ(index->equals({42})->size(), 100u);
+  EXPECT_EQ(index->equals({7})->back(), (RowID{ChunkID{505}, 7}));
+
+  // RowIDs are returned in the order of the rows
+  const auto pos_list = index->equals({30});
+  EXPECT_TRUE(std::is_sorted(pos_list->cbegin(), pos_list->cend()));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, CompositeKey) {
+  const auto index = table->create_index({ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(*index->equals({"name3", 7}), (PosList{{ChunkID{0}, 7}}));
+  EXPECT_EQ(*index->equals({"name2", 7}), (PosList{{ChunkID{8}, 2}}));
+  EXPECT_TRUE(index->equals({"name2", 30})->empty());
+
+  // lookups on a prefix of the key columns
+  EXPECT_EQ(index->equals({"name1"})->size(), 25u);
+  EXPECT_EQ(index->range({"name1"}, {"name3"})->size(), 50u);
+  EXPECT_EQ(index->range({"name1", 10}, {"name1", 20})->size(), 10u);
+}
+
+TEST_F(StorageBPlusTreeIndexTest, Range) {
+  const auto index = table->create_index({ColumnID{2}});
+  EXPECT_EQ(index->range({int64_t{10}}, {int64_t{20}})->size(), 10u);
+  EXPECT_EQ(index->range({int64_t{95}}, {int64_t{1000}})->size(), 5u);
+  EXPECT_TRUE(index->range({int64_t{20}}, {int64_t{10}})->empty());
+  // values of other types are converted to the column type
+  EXPECT_EQ(index->range({10}, {20})->size(), 10u);
+  EXPECT_EQ(*index->equals({42}), (PosList{{ChunkID{4}, 2}}));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, ResultsCanBeReferenced) {
+  const auto index = table->create_index({ColumnID{0}});
+  const auto segment = ReferenceSegment{table, ColumnID{2}, index->equals({3})};
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_EQ(segment[1], AllTypeVariant{int64_t{28}});
+}
+
+TEST_F(StorageBPlusTreeIndexTest, GetIndex) {
+  EXPECT_FALSE(table->get_index({ColumnID{0}}));
+  const auto index = table->create_index({ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(table->get_index({ColumnID{0}, ColumnID{1}}), index);
+  EXPECT_FALSE(table->get_index({ColumnID{0}}));
+  EXPECT_THROW(table->create_index({ColumnID{0}, ColumnID{1}}), std::exception);
+}
+
+TEST_F(StorageBPlusTreeIndexTest, EmptyTable) {
+  auto empty_table = Table{2};
+  empty_table.add_column("a", "int");
+  const auto index = empty_table.create_index({ColumnID{0}});
+  EXPECT_TRUE(index->equals({1})->empty());
+
+  for (auto i = 0; i < 200; ++i) empty_table.append({i / 2});
+  EXPECT_EQ(*index->equals({50}), (PosList{{ChunkID{50}, 0}, {ChunkID{50}, 1}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      vc_str->append(value);
+    }
+    dict_segment = std::make_shared<DictionarySegment<std::string>>(vc_str);
+    index = std::make_shared<GroupKeyIndex>(dict_segment);
+  }
+
+  // returns the offsets in [begin, end) in ascending order
+  static std::vector<ChunkOffset> offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    auto result = std::vector<ChunkOffset>(begin, end);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+  std::shared_ptr<DictionarySegment<std::string>> dict_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, IndexOffsets) {
+  // dictionary: apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()),
+            (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, LowerAndUpperBound) {
+  EXPECT_EQ(offsets(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->lower_bound({"inbox"}), index->upper_bound({"inbox"})), (std::vector<ChunkOffset>{7}));
+
+  // values that are not in the dictionary
+  EXPECT_EQ(index->lower_bound({"bravo"}), index->upper_bound({"bravo"}));
+  EXPECT_EQ(index->lower_bound({"aardvark"}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+
+  EXPECT_EQ(offsets(index->cbegin(), index->lower_bound({"delta"})), (std::vector<ChunkOffset>{4, 5, 6}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, IsIndexFor) {
+  EXPECT_TRUE(index->is_index_for({dict_segment}));
+  EXPECT_FALSE(index->is_index_for({std::make_shared<DictionarySegment<std::string>>(vc_str)}));
+  EXPECT_FALSE(index->is_index_for({dict_segment, dict_segment}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresDictionarySegment) {
+  EXPECT_THROW(GroupKeyIndex{vc_str}, std::exception);
+}
+
+TEST_F(StorageGroupKeyIndexTest, MemoryUsage) {
+  EXPECT_EQ(index->estimate_memory_usage(), (7u + 8u) * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
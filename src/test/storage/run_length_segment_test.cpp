@@ -0,0 +1,61 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentInt) {
+  for (auto value : {1, 1, 1, 4, 4, 1, 7}) vc_int->append(value);
+  auto segment = RunLengthSegment<int>{vc_int};
+
+  EXPECT_EQ(segment.size(), 7u);
+  EXPECT_EQ(segment.run_count(), 4u);
+  EXPECT_EQ(*segment.values(), (std::vector<int>{1, 4, 1, 7}));
+  EXPECT_EQ(*segment.end_positions(), (std::vector<ChunkOffset>{2, 4, 5, 6}));
+
+  EXPECT_EQ(segment.get(0), 1);
+  EXPECT_EQ(segment.get(2), 1);
+  EXPECT_EQ(segment.get(3), 4);
+  EXPECT_EQ(segment.get(5), 1);
+  EXPECT_EQ(segment[6], AllTypeVariant{7});
+
+  EXPECT_EQ(segment.estimate_memory_usage(), 4 * sizeof(int) + 4 * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  auto segment = RunLengthSegment<std::string>{vc_str};
+
+  EXPECT_EQ(segment.size(), 3u);
+  EXPECT_EQ(segment.run_count(), 2u);
+  EXPECT_EQ(segment.get(1), "Bill");
+  EXPECT_EQ(segment.get(2), "Steve");
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  auto segment = RunLengthSegment<int>{vc_int};
+  EXPECT_EQ(segment.size(), 0u);
+  EXPECT_EQ(segment.run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, IsImmutable) {
+  vc_int->append(1);
+  auto segment = RunLengthSegment<int>{vc_int};
+  EXPECT_THROW(segment.append(2), std::exception);
+  EXPECT_THROW(RunLengthSegment<std::string>{vc_int}, std::exception);
+}
+
+}  // namespace opossum
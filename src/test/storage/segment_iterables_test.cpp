@@ -0,0 +1,158 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables/dictionary_segment_iterable.hpp"
+#include "storage/segment_iterables/reference_segment_iterable.hpp"
+#include "storage/segment_iterables/value_segment_iterable.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 200; ++i) {
+      int_segment->append(i % 7);
+      string_segment->append("value" + std::to_string(i % 13));
+    }
+  }
+
+  template <typename Iterable, typename T>
+  void _expect_values(const Iterable& iterable, const std::vector<T>& expected_values) {
+    auto values = std::vector<T>{};
+    iterable.for_each([&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), values.size());
+      values.emplace_back(position.value());
+    });
+    EXPECT_EQ(values, expected_values);
+  }
+
+  std::shared_ptr<ValueSegment<int>> int_segment = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(SegmentIterablesTest, ValueSegmentIterable) {
+  const auto& values = int_segment->values();
+  _expect_values(ValueSegmentIterable<int>{*int_segment}, std::vector<int>(values.cbegin(), values.cend()));
+
+  // the values are not copied
+  ValueSegmentIterable<std::string>{*string_segment}.with_iterators([&](auto it, const auto end) {
+    EXPECT_EQ(&it->value(), &string_segment->values()[0]);
+  });
+}
+
+TEST_F(SegmentIterablesTest, ValueSegmentIterableWithSize) {
+  _expect_values(ValueSegmentIterable<int>{*int_segment, 3}, std::vector<int>{0, 1, 2});
+  _expect_values(ValueSegmentIterable<int>{*int_segment, 0}, std::vector<int>{});
+}
+
+TEST_F(SegmentIterablesTest, DictionarySegmentIterable) {
+  const auto& values = int_segment->values();
+  const auto expected_values = std::vector<int>(values.cbegin(), values.cend());
+  for (const auto type : {AttributeVectorType::FixedSize, AttributeVectorType::BitPacked,
+                          AttributeVectorType::SimdBp128}) {
+    const auto segment = DictionarySegment<int>{int_segment, type};
+    _expect_values(DictionarySegmentIterable<int>{segment}, expected_values);
+  }
+}
+
+TEST_F(SegmentIterablesTest, DictionarySegmentIterableWithStrings) {
+  const auto& values = string_segment->values();
+  const auto expected_values = std::vector<std::string>(values.cbegin(), values.cend());
+
+  const auto segment = DictionarySegment<std::string>{string_segment};
+  const auto iterable = DictionarySegmentIterable<std::string>{segment};
+  iterable.with_iterators([](auto it, const auto end) {
+    static_assert(std::is_same_v<decltype(it->value()), std::string_view>);
+  });
+  _expect_values(iterable, expected_values);
+
+  const auto front_coded_segment = FrontCodedDictionarySegment{string_segment};
+  _expect_values(DictionarySegmentIterable<std::string, FrontCodedStringVector>{front_coded_segment},
+                 expected_values);
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegmentIterable) {
+  // one chunk per encoding, with the values 0 .. 19
+  const auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 20; ++i) table->append({i});
+  table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+  table->compress_chunk(ChunkID{3}, EncodingType::FrameOfReference);
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      {ChunkID{3}, 4}, {ChunkID{0}, 1}, {ChunkID{0}, 0}, {ChunkID{1}, 2}, {ChunkID{2}, 3}, {ChunkID{2}, 0},
+      {ChunkID{0}, 4}});
+  const auto segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  const auto iterable = ReferenceSegmentIterable<int>{segment};
+  _expect_values(iterable, std::vector<int>{19, 1, 0, 7, 13, 10, 4});
+
+  // the functor is called once per range of positions in the same chunk
+  auto range_count = 0;
+  iterable.with_iterators([&](auto it, const auto end) { ++range_count; });
+  EXPECT_EQ(range_count, 5);
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegmentIterableWithStrings) {
+  const auto table = std::make_shared<Table>(2);
+  table->add_column("a", "string");
+  for (const auto& value : {"Bill", "Steve", "Alexander", "Hasso", "Martin", "Bill"}) table->append({value});
+  table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{2}, EncodingType::FrontCodedDictionary);
+
+  const auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>{{ChunkID{2}, 1}, {ChunkID{1}, 0}, {ChunkID{0}, 1}, {ChunkID{2}, 0}});
+  _expect_values(ReferenceSegmentIterable<std::string>{ReferenceSegment{table, ColumnID{0}, pos_list}},
+                 std::vector<std::string>{"Bill", "Alexander", "Steve", "Martin"});
+}
+
+TEST_F(SegmentIterablesTest, DictionaryIteratorsProvideValueIds) {
+  const auto segment = DictionarySegment<int>{int_segment, AttributeVectorType::SimdBp128};
+  DictionarySegmentIterable<int>{segment}.with_iterators([&](auto it, const auto end) {
+    static_assert(has_value_ids_v<decltype(it)>);
+    EXPECT_EQ(&it.dictionary_segment(), &segment);
+    for (; it != end; ++it) EXPECT_EQ(it.value_id(), segment.attribute_vector()->get(it.chunk_offset()));
+  });
+  ValueSegmentIterable<int>{*int_segment}.with_iterators([](auto it, const auto end) {
+    static_assert(!has_value_ids_v<decltype(it)>);
+  });
+
+  // only the ranges of a ReferenceSegment that reference a dictionary segment provide value ids
+  const auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 10; ++i) table->append({i});
+  table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+  const auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>{{ChunkID{0}, 1}, {ChunkID{1}, 3}, {ChunkID{1}, 0}});
+  auto dictionary_range_count = 0;
+  ReferenceSegmentIterable<int>{ReferenceSegment{table, ColumnID{0}, pos_list}}.with_iterators(
+      [&](auto it, const auto end) {
+        if constexpr (has_value_ids_v<decltype(it)>) {
+          ++dictionary_range_count;
+          EXPECT_EQ(it.chunk_offset(), 1u);
+          EXPECT_EQ(it.value_id(), ValueID{3});
+          EXPECT_EQ(it.dictionary_segment().value_by_value_id(it.value_id()), 8);
+        }
+      });
+  EXPECT_EQ(dictionary_range_count, 1);
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegmentIterableWithEmptyPosList) {
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  _expect_values(ReferenceSegmentIterable<int>{ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>()}},
+                 std::vector<int>{});
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/front_coded_string_vector.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/hash.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 10000; ++i) vc_int->append(i % 2000 - 500);
+    for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) vc_str->append(value);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentStatisticsTest, ValueSegment) {
+  const auto statistics = create_segment_statistics("int", *vc_int);
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{-500});
+  EXPECT_EQ(statistics->max, AllTypeVariant{1499});
+  // the estimate has a standard error of about 3%
+  EXPECT_NEAR(static_cast<double>(statistics->distinct_count), 2000.0, 200.0);
+}
+
+TEST_F(StorageSegmentStatisticsTest, SmallDistinctCountIsAccurate) {
+  const auto statistics = create_segment_statistics("string", *vc_str);
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{"Alexander"});
+  EXPECT_EQ(statistics->max, AllTypeVariant{"Steve"});
+  EXPECT_EQ(statistics->distinct_count, 4u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, EncodedSegments) {
+  const auto dictionary_statistics = create_segment_statistics("int", DictionarySegment<int>{vc_int});
+  EXPECT_EQ(dictionary_statistics->min, AllTypeVariant{-500});
+  EXPECT_EQ(dictionary_statistics->max, AllTypeVariant{1499});
+  EXPECT_EQ(dictionary_statistics->distinct_count, 2000u);
+
+  const auto run_length_statistics = create_segment_statistics("int", RunLengthSegment<int>{vc_int});
+  EXPECT_EQ(run_length_statistics->min, AllTypeVariant{-500});
+  EXPECT_EQ(run_length_statistics->max, AllTypeVariant{1499});
+
+  const auto frame_of_reference_statistics = create_segment_statistics("int", FrameOfReferenceSegment<int>{vc_int});
+  EXPECT_EQ(frame_of_reference_statistics->min, AllTypeVariant{-500});
+  EXPECT_EQ(frame_of_reference_statistics->max, AllTypeVariant{1499});
+
+  const auto front_coded_statistics = create_segment_statistics("string", FrontCodedDictionarySegment{vc_str});
+  EXPECT_EQ(front_coded_statistics->min, AllTypeVariant{"Alexander"});
+  EXPECT_EQ(front_coded_statistics->max, AllTypeVariant{"Steve"});
+  EXPECT_EQ(front_coded_statistics->distinct_count, 4u);
+}
+
+TEST_F(StorageSegmentStatisticsTest, BloomFilter) {
+  auto vc_sparse_int = std::make_shared<ValueSegment<int>>();
+  for (auto i = 0; i < 10000; ++i) vc_sparse_int->append((i % 2000) * 7919);
+  const auto value_statistics = create_segment_statistics("int", *vc_sparse_int);
+  const auto run_length_statistics = create_segment_statistics("int", RunLengthSegment<int>{vc_sparse_int});
+  for (const auto& statistics : {value_statistics, run_length_statistics}) {
+    ASSERT_TRUE(statistics->bloom_filter);
+    for (auto value = 0; value < 2000; ++value) {
+      EXPECT_TRUE(statistics->bloom_filter->may_contain(mixed_hash(value * 7919)));
+    }
+  }
+
+  const auto string_statistics = create_segment_statistics("string", *vc_str);
+  ASSERT_TRUE(string_statistics->bloom_filter);
+  EXPECT_TRUE(string_statistics->bloom_filter->may_contain(mixed_hash(std::string{"Hasso"})));
+}
+
+TEST_F(StorageSegmentStatisticsTest, NoBloomFilterForDenseOrDictionarySegments) {
+  // 2000 distinct values within [-500, 1499] are pruned by min and max alone
+  EXPECT_FALSE(create_segment_statistics("int", *vc_int)->bloom_filter);
+  EXPECT_FALSE(create_segment_statistics("string", DictionarySegment<std::string>{vc_str})->bloom_filter);
+  EXPECT_FALSE(create_segment_statistics("string", FrontCodedDictionarySegment{vc_str})->bloom_filter);
+}
+
+TEST_F(StorageSegmentStatisticsTest, EmptySegment) {
+  EXPECT_FALSE(create_segment_statistics("int", ValueSegment<int>{}));
+}
+
+}  // namespace opossum
@@ -1,53 +1,185 @@
+#include <filesystem>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/storage/segment_encoding_utils.hpp"
 #include "../lib/storage/storage_manager.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
 
-// class StorageStorageManagerTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     auto& sm = StorageManager::get();
-//     auto t1 = std::make_shared<Table>();
-//     auto t2 = std::make_shared<Table>(4);
-
-//     sm.add_table("first_table", t1);
-//     sm.add_table("second_table", t2);
-//   }
-// };
-
-// TEST_F(StorageStorageManagerTest, GetTable) {
-//   auto& sm = StorageManager::get();
-//   auto t3 = sm.get_table("first_table");
-//   auto t4 = sm.get_table("second_table");
-//   EXPECT_THROW(sm.get_table("third_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, DropTable) {
-//   auto& sm = StorageManager::get();
-//   sm.drop_table("first_table");
-//   EXPECT_THROW(sm.get_table("first_table"), std::exception);
-//   EXPECT_THROW(sm.drop_table("first_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, ResetTable) {
-//   StorageManager::get().reset();
-//   auto& sm = StorageManager::get();
-//   EXPECT_THROW(sm.get_table("first_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, DoesNotHaveTable) {
-//   auto& sm = StorageManager::get();
-//   EXPECT_EQ(sm.has_table("third_table"), false);
-// }
-
-// TEST_F(StorageStorageManagerTest, HasTable) {
-//   auto& sm = StorageManager::get();
-//   EXPECT_EQ(sm.has_table("first_table"), true);
-// }
+class StorageStorageManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto& sm = StorageManager::get();
+    auto t1 = std::make_shared<Table>();
+    auto t2 = std::make_shared<Table>(4);
+
+    sm.add_table("first_table", t1);
+    sm.add_table("second_table", t2);
+  }
+
+  // creates a table with three compressed chunks of 100 ints each
+  static std::shared_ptr<Table> create_compressed_table() {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    for (auto i = 0; i < 300; ++i) table->append({i});
+    table->compress_chunks({ChunkID{0}, ChunkID{1}, ChunkID{2}});
+    return table;
+  }
+
+  const std::string _spill_directory = (std::filesystem::temp_directory_path() / "opossum_spill_test").string();
+};
+
+TEST_F(StorageStorageManagerTest, GetTable) {
+  auto& sm = StorageManager::get();
+  auto t3 = sm.get_table("first_table");
+  auto t4 = sm.get_table("second_table");
+  EXPECT_THROW(sm.get_table("third_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, DropTable) {
+  auto& sm = StorageManager::get();
+  sm.drop_table("first_table");
+  EXPECT_THROW(sm.get_table("first_table"), std::exception);
+  EXPECT_THROW(sm.drop_table("first_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, ResetTable) {
+  StorageManager::get().reset();
+  auto& sm = StorageManager::get();
+  EXPECT_THROW(sm.get_table("first_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, DoesNotHaveTable) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.has_table("third_table"), false);
+}
+
+TEST_F(StorageStorageManagerTest, HasTable) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.has_table("first_table"), true);
+}
+
+TEST_F(StorageStorageManagerTest, TableNamesAndPrint) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.table_names(), (std::vector<std::string>{"first_table", "second_table"}));
+
+  auto output = std::ostringstream{};
+  sm.print(output);
+  EXPECT_NE(output.str().find("second_table"), std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, EvictsChunksOverBudget) {
+  auto& sm = StorageManager::get();
+  const auto table = create_compressed_table();
+  sm.add_table("compressed_table", table);
+  const auto chunk_memory_usage = table->get_chunk(ChunkID{0}).memory_usage();
+  EXPECT_EQ(sm.memory_usage(), 3 * chunk_memory_usage);
+
+  sm.set_memory_budget(chunk_memory_usage, _spill_directory);
+  EXPECT_LE(sm.memory_usage(), chunk_memory_usage);
+
+  // evicted chunks are paged back in on access
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    const auto segment = table->get_chunk(chunk_id).get_segment(ColumnID{0});
+    EXPECT_EQ(table->get_chunk(chunk_id).size(), 100u);
+    EXPECT_EQ((*segment)[ChunkOffset{42}], AllTypeVariant{static_cast<int>(chunk_id * 100 + 42)});
+  }
+  std::filesystem::remove_all(_spill_directory);
+}
+
+TEST_F(StorageStorageManagerTest, EvictedChunksKeepTheirEncodingAndMemoryUsage) {
+  auto& sm = StorageManager::get();
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto i = 0; i < 200; ++i) table->append({i / 10, "value_" + std::to_string(i / 10)});
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  auto& chunk = table->get_chunk(ChunkID{1});
+  chunk.replace_segments({encode_segment(EncodingType::FrameOfReference, "int", chunk.get_segment(ColumnID{0})),
+                          encode_segment(EncodingType::FrontCodedDictionary, "string", chunk.get_segment(ColumnID{1}))},
+                         {});
+  sm.add_table("encoded_table", table);
+
+  auto memory_usages = std::vector<size_t>{};
+  auto segment_types = std::vector<std::type_index>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    memory_usages.push_back(table->get_chunk(chunk_id).memory_usage());
+    for (auto column_id = ColumnID{0}; column_id < 2; ++column_id) {
+      const auto segment = table->get_chunk(chunk_id).get_segment(column_id);
+      segment_types.emplace_back(typeid(*segment));
+    }
+  }
+
+  sm.set_memory_budget(0, _spill_directory);
+  EXPECT_EQ(sm.memory_usage(), 0u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    for (auto column_id = ColumnID{0}; column_id < 2; ++column_id) {
+      const auto segment = table->get_chunk(chunk_id).get_segment(column_id);
+      EXPECT_EQ(std::type_index{typeid(*segment)}, segment_types[chunk_id * 2 + column_id]);
+    }
+    EXPECT_EQ(table->get_chunk(chunk_id).memory_usage(), memory_usages[chunk_id]);
+  }
+  std::filesystem::remove_all(_spill_directory);
+}
+
+TEST_F(StorageStorageManagerTest, DoesNotEvictPinnedOrMutableChunks) {
+  auto& sm = StorageManager::get();
+  const auto table = create_compressed_table();
+  table->append({300});
+  sm.add_table("compressed_table", table);
+
+  // a segment that is held by a reader pins its chunk
+  const auto pinned_segment = table->get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+  sm.set_memory_budget(0, _spill_directory);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).memory_usage(), 0u);
+  EXPECT_GT(table->get_chunk(ChunkID{1}).memory_usage(), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2}).memory_usage(), 0u);
+  EXPECT_GT(table->get_chunk(ChunkID{3}).memory_usage(), 0u);
+  EXPECT_EQ(sm.memory_usage(),
+            table->get_chunk(ChunkID{1}).memory_usage() + table->get_chunk(ChunkID{3}).memory_usage());
+  std::filesystem::remove_all(_spill_directory);
+}
+
+TEST_F(StorageStorageManagerTest, ReplaceTable) {
+  auto& sm = StorageManager::get();
+  const auto previous_table = sm.get_table("second_table");
+  const auto new_table = std::make_shared<Table>(2);
+  sm.replace_table("second_table", new_table);
+  EXPECT_EQ(sm.get_table("second_table"), new_table);
+  EXPECT_EQ(previous_table->target_chunk_size(), 4u);
+  EXPECT_THROW(sm.replace_table("third_table", new_table), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentLookupsWhileReplacing) {
+  auto& sm = StorageManager::get();
+  const auto initial_table = sm.get_table("first_table");
+  const auto versions = std::vector<std::shared_ptr<Table>>{std::make_shared<Table>(1), std::make_shared<Table>(2)};
+
+  auto readers = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    readers.emplace_back([&] {
+      for (auto lookup = 0; lookup < 10'000; ++lookup) {
+        ASSERT_TRUE(sm.has_table("first_table"));
+        const auto table = sm.get_table("first_table");
+        ASSERT_TRUE(table == initial_table || table == versions[0] || table == versions[1]);
+      }
+    });
+  }
+  for (auto replacement = 0; replacement < 1'000; ++replacement) {
+    sm.replace_table("first_table", versions[replacement % 2]);
+  }
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(sm.get_table("first_table"), versions[1]);
+}
 
 }  // namespace opossum
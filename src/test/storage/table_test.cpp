@@ -1,6 +1,11 @@
+#include <algorithm>
+#include <chrono>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,67 +13,432 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/b_plus_tree_index.hpp"
+#include "../lib/storage/index/group_key_index.hpp"
+#include "../lib/storage/mvcc_data.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_statistics.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/utils/memory_resources.hpp"
 
 namespace opossum {
 
-// class StorageTableTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     t.add_column("col_1", "int");
-//     t.add_column("col_2", "string");
-//   }
-
-//   Table t{2};
-// };
-
-// TEST_F(StorageTableTest, ChunkCount) {
-//   EXPECT_EQ(t.chunk_count(), 1u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.chunk_count(), 2u);
-// }
-
-// TEST_F(StorageTableTest, GetChunk) {
-//   t.get_chunk(ChunkID{0});
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   t.get_chunk(ChunkID{1});
-// }
-
-// TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
-
-// TEST_F(StorageTableTest, RowCount) {
-//   EXPECT_EQ(t.row_count(), 0u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.row_count(), 3u);
-// }
-
-// TEST_F(StorageTableTest, GetColumnName) {
-//   EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
-//   EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnType) {
-//   EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-//   EXPECT_EQ(t.column_type(ColumnID{1}), "string");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnIdByName) {
-//   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
-//   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.target_chunk_size(), 2u); }
+class StorageTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t.add_column("col_1", "int");
+    t.add_column("col_2", "string");
+  }
+
+  Table t{2};
+};
+
+TEST_F(StorageTableTest, ChunkCount) {
+  EXPECT_EQ(t.chunk_count(), 1u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
+TEST_F(StorageTableTest, GetChunk) {
+  t.get_chunk(ChunkID{0});
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.get_chunk(ChunkID{1});
+}
+
+TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
+
+TEST_F(StorageTableTest, RowCount) {
+  EXPECT_EQ(t.row_count(), 0u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, GetColumnName) {
+  EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
+  EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnType) {
+  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
+  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnIdByName) {
+  EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
+  EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
+}
+
+TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.target_chunk_size(), 2u); }
+
+TEST_F(StorageTableTest, AddColumnToNonEmptyTable) {
+  t.append({4, "Hello,"});
+  EXPECT_THROW(t.add_column("col_3", "int"), std::exception);
+}
+
+TEST_F(StorageTableTest, UnlimitedChunkSize) {
+  auto table = Table{0};
+  table.add_column("col_1", "int");
+  for (auto i = 0; i < 10; ++i) table.append({i});
+  EXPECT_EQ(table.chunk_count(), 1u);
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({1, "a"});
+  t.append_columns({std::make_shared<ValueSegment<int>>(pmr_vector<int>{2, 3, 4, 5}),
+                    std::make_shared<ValueSegment<std::string>>(pmr_vector<std::string>{"b", "c", "d", "e"})});
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 2u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"b"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[0], AllTypeVariant{5});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).get_statistics(ColumnID{0})->max, AllTypeVariant{4});
+
+  EXPECT_THROW(t.append_columns({std::make_shared<ValueSegment<int>>(pmr_vector<int>{1})}), std::exception);
+  EXPECT_THROW(t.append_columns({std::make_shared<ValueSegment<int>>(pmr_vector<int>{1}),
+                                 std::make_shared<ValueSegment<int>>(pmr_vector<int>{2})}),
+               std::exception);
+  EXPECT_EQ(t.row_count(), 5u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsAdoptsOwnedBatchOfTableMemoryResource) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  const auto values_of_chunk = [&](const ChunkID chunk_id) -> const pmr_vector<int>& {
+    return static_cast<const ValueSegment<int>&>(*table.get_chunk(chunk_id).get_segment(ColumnID{0})).values();
+  };
+  auto values = pmr_vector<int>({1, 2}, table.memory_resource());
+  const auto* const data = values.data();
+  table.append_columns(std::move(values));
+  EXPECT_EQ(values_of_chunk(ChunkID{0}).data(), data);
+
+  // batches that do not start a chunk or are allocated elsewhere are copied
+  table.append_columns(pmr_vector<int>({3}, table.memory_resource()));
+  EXPECT_EQ(values_of_chunk(ChunkID{0}).size(), 3u);
+  table.append_columns(pmr_vector<int>{4, 5});
+  EXPECT_EQ(values_of_chunk(ChunkID{1}).get_allocator().resource(), table.memory_resource());
+  const auto more_values = std::vector<int>{6};
+  table.append_columns(std::span<const int>{more_values});
+  EXPECT_EQ(table.row_count(), 6u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsCopiesSharedBatches) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  const auto batch = std::make_shared<ValueSegment<int>>(pmr_vector<int>({1, 2}, table.memory_resource()));
+  table.append_columns({batch});
+  EXPECT_NE(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), batch);
+
+  // the same batch can be appended again without being modified, but a segment of the table cannot be appended
+  table.append_columns({batch});
+  EXPECT_EQ(batch->size(), 2u);
+  EXPECT_EQ(table.row_count(), 4u);
+  table.create_new_chunk();
+  table.append({5});
+  EXPECT_THROW(table.append_columns({table.get_chunk(ChunkID{1}).get_segment(ColumnID{0})}), std::exception);
+  EXPECT_EQ(table.row_count(), 5u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsUpdatesIndexes) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  const auto index = table.create_index({ColumnID{0}});
+  table.append({10});
+  table.append_columns({std::make_shared<ValueSegment<int>>(pmr_vector<int>{7, 10, 3})});
+  EXPECT_EQ(*index->equals({10}), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(*index->equals({3}), (PosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(StorageTableTest, EmplaceChunkUpdatesIndexes) {
+  auto table = Table{2};
+  table.add_column("a", "int");
+  const auto index = table.create_index({ColumnID{0}});
+  table.append({10});
+
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<int>>(pmr_vector<int>{3, 10}));
+  table.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(*index->equals({10}), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(*index->equals({3}), (PosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(StorageTableTest, AllocatesSegmentsFromMemoryResource) {
+  t.append({4, "Hello,"});
+  EXPECT_EQ(t.memory_resource(), storage_memory_resource());
+  const auto value_segment =
+      std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_EQ(value_segment->values().get_allocator().resource(), t.memory_resource());
+
+  t.compress_chunk(ChunkID{0});
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_EQ(dictionary_segment->dictionary()->get_allocator().resource(), t.memory_resource());
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(t.get_chunk(ChunkID{1}).get_segment(ColumnID{0})));
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[0], AllTypeVariant{"!"});
+}
+
+TEST_F(StorageTableTest, CompressChunks) {
+  for (auto i = 0; i < 7; ++i) t.append({i % 3, std::to_string(i)});
+  t.compress_chunks({ChunkID{0}, ChunkID{2}, ChunkID{3}});
+
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{2}, ChunkID{3}}) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(chunk_id).get_segment(ColumnID{0})));
+    EXPECT_TRUE(t.get_chunk(chunk_id).get_statistics(ColumnID{1}));
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{1}).get_segment(ColumnID{0})));
+  EXPECT_EQ((*t.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[1], AllTypeVariant{2});
+  EXPECT_EQ((*t.get_chunk(ChunkID{3}).get_segment(ColumnID{1}))[0], AllTypeVariant{"6"});
+
+  // the chunks are compressed already
+  EXPECT_THROW(t.compress_chunks({ChunkID{0}}), std::exception);
+}
+
+TEST_F(StorageTableTest, StatisticsOfFullAndCompressedChunks) {
+  t.append({4, "Hello,"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).get_statistics(ColumnID{0}));
+
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto statistics = t.get_chunk(ChunkID{0}).get_statistics(ColumnID{0});
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{4});
+  EXPECT_EQ(statistics->max, AllTypeVariant{6});
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_statistics(ColumnID{1})->max, AllTypeVariant{"world"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).get_statistics(ColumnID{0}));
+
+  t.compress_chunk(ChunkID{1});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).get_statistics(ColumnID{1})->min, AllTypeVariant{"!"});
+}
+
+TEST_F(StorageTableTest, CompressChunkAutomatically) {
+  auto table = Table{5000};
+  table.add_column("sorted", "int");
+  table.add_column("category", "string");
+  for (auto i = 0; i < 5000; ++i) table.append({i / 100, "category_" + std::to_string(i % 7)});
+
+  const auto reports = table.compress_chunk_automatically(ChunkID{0});
+  ASSERT_EQ(reports.size(), 2u);
+  EXPECT_EQ(reports[0].column_id, ColumnID{0});
+  EXPECT_EQ(reports[0].spec.encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(reports[1].spec.encoding_type, EncodingType::Dictionary);
+  for (auto column_id = ColumnID{0}; column_id < 2; ++column_id) {
+    const auto& segment = *table.get_chunk(ChunkID{0}).get_segment(column_id);
+    EXPECT_EQ(reports[column_id].actual_memory_usage, segment.estimate_memory_usage());
+    EXPECT_GT(reports[column_id].estimated_memory_usage, 0u);
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  EXPECT_EQ((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[4999], AllTypeVariant{"category_1"});
+}
+
+TEST_F(StorageTableTest, BackgroundCompression) {
+  t.enable_background_compression();
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.create_new_chunk();
+  t.append({7, "?"});
+  t.wait_for_background_compression();
+
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(ChunkID{1}).get_segment(ColumnID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{2}).get_segment(ColumnID{0})));
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).get_statistics(ColumnID{0})->max, AllTypeVariant{3});
+  EXPECT_EQ(t.row_count(), 4u);
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionKeepsIndexesOfManuallyCompressedChunks) {
+  t.enable_background_compression();
+  t.append({4, "Hello,"});
+  t.compress_chunk(ChunkID{0});
+  auto& chunk = t.get_chunk(ChunkID{0});
+  const auto index = std::make_shared<GroupKeyIndex>(chunk.get_segment(ColumnID{0}));
+  chunk.add_index(index);
+
+  // the job that is queued when the chunk is closed finds nothing to compress and leaves the chunk as it is
+  t.create_new_chunk();
+  t.wait_for_background_compression();
+  EXPECT_EQ(chunk.get_indexes({ColumnID{0}}), (std::vector<std::shared_ptr<BaseIndex>>{index}));
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionReportsErrors) {
+  auto table = Table{2};
+  table.add_column("a", "float");
+  table.enable_background_compression(EncodingType::FrameOfReference);
+  table.append({1.5f});
+  table.append({2.5f});
+  EXPECT_THROW(table.wait_for_background_compression(), std::exception);
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionReportsErrorsOfFinishedJobs) {
+  auto table = Table{2};
+  table.add_column("a", "float");
+  table.enable_background_compression(EncodingType::FrameOfReference);
+  table.append({1.5f});
+  table.append({2.5f});
+
+  // closing the next chunk forgets the failed job of the first one, but not its error
+  std::this_thread::sleep_for(std::chrono::milliseconds{50});
+  table.append({3.5f});
+  table.append({4.5f});
+  EXPECT_THROW(table.wait_for_background_compression(), std::exception);
+  EXPECT_NO_THROW(table.wait_for_background_compression());
+}
+
+TEST_F(StorageTableTest, ClosingMvccChunkShrinksSegments) {
+  auto table = Table{10, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  for (auto i = 0; i < 3; ++i) table.append({i});
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).size(), 3u);
+  const auto preallocated_segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  table.create_new_chunk();
+  table.append({3});
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->size(), 3u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[2], AllTypeVariant{2});
+
+  // readers of the preallocated segment are not affected, as it is replaced instead of shrunk
+  EXPECT_EQ(preallocated_segment->size(), 10u);
+  EXPECT_EQ((*preallocated_segment)[2], AllTypeVariant{2});
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_statistics(ColumnID{0})->max, AllTypeVariant{2});
+  EXPECT_EQ(table.row_count(), 4u);
+
+  // the chunk does not accept rows anymore
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).reserve_rows(1).second, 0u);
+  EXPECT_THROW(table.create_index({ColumnID{0}}), std::exception);
+}
+
+TEST_F(StorageTableTest, OnlyFinalizedMvccChunksCanBeCompressed) {
+  auto table = Table{10, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  table.append({1});
+  EXPECT_FALSE(table.get_chunk(ChunkID{0}).is_finalized());
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}), std::exception);
+  EXPECT_THROW(table.compress_chunk_automatically(ChunkID{0}), std::exception);
+
+  // the open chunk is still appended to
+  table.append({2});
+  table.create_new_chunk();
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).is_finalized());
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->size(), 2u);
+}
+
+TEST_F(StorageTableTest, FailedMvccAppendDoesNotBlockLaterAppends) {
+  auto table = Table{2, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  // the value is rejected before a row is reserved
+  EXPECT_THROW(table.append({"abc"}), std::exception);
+  table.append({1});
+  table.append({2});
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).size(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_statistics(ColumnID{0})->max, AllTypeVariant{2});
+
+  // a row whose value cannot be set is published anyway, but hidden from transactions
+  auto& chunk = table.get_chunk(ChunkID{1});
+  EXPECT_THROW(chunk.append({"abc"}), std::exception);
+  table.append({3});
+  EXPECT_EQ(chunk.size(), 2u);
+  EXPECT_EQ(chunk.mvcc_data()->begin_cids[0], MAX_COMMIT_ID);
+  EXPECT_EQ(chunk.mvcc_data()->begin_cids[1], CommitID{0});
+}
+
+TEST_F(StorageTableTest, MvccRowsArePublishedWithoutWaiting) {
+  auto table = Table{3, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  auto& chunk = table.get_chunk(ChunkID{0});
+  const auto [first_offset, first_row_count] = chunk.reserve_rows(1);
+  const auto [second_offset, second_row_count] = chunk.reserve_rows(2);
+
+  // the second writer is done before the first one and does not wait for it, but its rows are not visible yet
+  chunk.set_row(second_offset, {2});
+  chunk.set_row(second_offset + 1, {3});
+  EXPECT_FALSE(chunk.publish_rows(second_offset, second_row_count));
+  EXPECT_EQ(chunk.size(), 0u);
+
+  // the first writer publishes all rows and thereby completes the chunk
+  chunk.set_row(first_offset, {1});
+  EXPECT_TRUE(chunk.publish_rows(first_offset, first_row_count));
+  EXPECT_EQ(chunk.size(), 3u);
+}
+
+TEST_F(StorageTableTest, ConcurrentAppends) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto ROWS_PER_THREAD = 2000;
+  constexpr auto BATCH_SIZE = 50;
+  auto table = Table{128, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.enable_background_compression();
+
+  // half of the rows of each writer are appended one by one, the other half in batches
+  auto writers = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    writers.emplace_back([&, thread_id] {
+      const auto first_value = thread_id * ROWS_PER_THREAD;
+      for (auto value = first_value; value < first_value + ROWS_PER_THREAD / 2; ++value) {
+        table.append({value, std::to_string(value)});
+      }
+      for (auto begin = first_value + ROWS_PER_THREAD / 2; begin < first_value + ROWS_PER_THREAD;
+           begin += BATCH_SIZE) {
+        auto values = pmr_vector<int>(BATCH_SIZE);
+        auto strings = pmr_vector<std::string>{};
+        std::iota(values.begin(), values.end(), begin);
+        for (const auto value : values) strings.push_back(std::to_string(value));
+        table.append_columns({std::make_shared<ValueSegment<int>>(std::move(values)),
+                              std::make_shared<ValueSegment<std::string>>(std::move(strings))});
+      }
+    });
+  }
+  for (auto& writer : writers) writer.join();
+  table.wait_for_background_compression();
+
+  ASSERT_EQ(table.row_count(), uint64_t{THREAD_COUNT * ROWS_PER_THREAD});
+  auto values = std::vector<int>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk_id + 1 < table.chunk_count()) {
+      EXPECT_EQ(chunk.size(), 128u);
+      EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(chunk.get_segment(ColumnID{0})));
+    }
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto value = type_cast<int>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+      EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(value)});
+      values.push_back(value);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  for (auto index = 0; index < THREAD_COUNT * ROWS_PER_THREAD; ++index) ASSERT_EQ(values[index], index);
+}
 
 }  // namespace opossum
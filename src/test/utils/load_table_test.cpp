@@ -0,0 +1,114 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class LoadTableTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  void write_file(const std::string& content) {
+    auto stream = std::ofstream{_file_name, std::ios::binary};
+    stream << content;
+  }
+
+  const std::string _file_name = (std::filesystem::temp_directory_path() / "opossum_load_table_test.tbl").string();
+};
+
+TEST_F(LoadTableTest, LoadsLargeFilesInOrder) {
+  // several megabytes, so that the file is parsed in multiple ranges
+  auto content = std::string{"id|name|price|big\nint|string|double|long\n"};
+  constexpr auto ROW_COUNT = 200'000;
+  for (auto i = 0; i < ROW_COUNT; ++i) {
+    content += std::to_string(i) + "|name_" + std::to_string(i % 13) + "|" + std::to_string(i) + ".25|" +
+               std::to_string(int64_t{i} * 100'000'000) + "\n";
+  }
+  write_file(content);
+
+  const auto table = load_table(_file_name, 1000);
+  EXPECT_EQ(table->column_names(), (std::vector<std::string>{"id", "name", "price", "big"}));
+  EXPECT_EQ(table->column_type(ColumnID{3}), "long");
+  EXPECT_EQ(table->row_count(), uint64_t{ROW_COUNT});
+  EXPECT_EQ(table->chunk_count(), ChunkID{ROW_COUNT / 1000});
+  for (const auto row : {0, 999, 1000, 123'456, ROW_COUNT - 1}) {
+    const auto& chunk = table->get_chunk(ChunkID{static_cast<ChunkID::base_type>(row / 1000)});
+    const auto chunk_offset = static_cast<ChunkOffset>(row % 1000);
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{row});
+    EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{"name_" + std::to_string(row % 13)});
+    EXPECT_EQ((*chunk.get_segment(ColumnID{2}))[chunk_offset], AllTypeVariant{row + 0.25});
+    EXPECT_EQ((*chunk.get_segment(ColumnID{3}))[chunk_offset], AllTypeVariant{int64_t{row} * 100'000'000});
+  }
+}
+
+TEST_F(LoadTableTest, LoadCompressedTable) {
+  auto content = std::string{"id|name\nint|string\n"};
+  for (auto i = 0; i < 10'000; ++i) {
+    content += std::to_string(i % 100) + "|name_" + std::to_string(i % 13) + "\n";
+    if (i == 5000) content += "\n";
+  }
+  write_file(content);
+
+  const auto table = load_compressed_table(_file_name, 1024);
+  const auto expected_table = load_table(_file_name, 1024);
+  EXPECT_TABLE_EQ(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), ChunkID{10});
+  EXPECT_EQ(table->get_chunk(ChunkID{9}).size(), 10'000u - 9 * 1024);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})));
+    EXPECT_EQ(chunk.get_statistics(ColumnID{0})->max, AllTypeVariant{99});
+  }
+
+  const auto run_length_table = load_compressed_table(_file_name, 0, EncodingType::RunLength);
+  EXPECT_EQ(run_length_table->chunk_count(), ChunkID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(
+      run_length_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+
+  write_file("a\nint\n1\n2\nx\n3\n");
+  EXPECT_THROW(load_compressed_table(_file_name, 1), std::exception);
+}
+
+TEST_F(LoadTableTest, WindowsLineBreaksAndMissingFinalLineBreak) {
+  write_file("a|b\r\nint|float\r\n1|1.5\r\n\r\n2|2.5");
+  const auto table = load_table(_file_name, 0);
+  EXPECT_EQ(table->column_name(ColumnID{1}), "b");
+  ASSERT_EQ(table->row_count(), 2u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{2.5f});
+}
+
+TEST_F(LoadTableTest, TrailingDelimiters) {
+  write_file("a|b|\nint|string|\n1|x|\n2|y\n3||\n");
+  const auto table = load_table(_file_name, 0);
+  ASSERT_EQ(table->column_count(), 2u);
+  ASSERT_EQ(table->row_count(), 3u);
+  const auto& segment = *table->get_chunk(ChunkID{0}).get_segment(ColumnID{1});
+  EXPECT_EQ(segment[0], AllTypeVariant{"x"});
+  EXPECT_EQ(segment[1], AllTypeVariant{"y"});
+  EXPECT_EQ(segment[2], AllTypeVariant{""});
+
+  write_file("a|b\nint|int\n1|2||\n");
+  EXPECT_THROW(load_table(_file_name, 0), std::exception);
+}
+
+TEST_F(LoadTableTest, RejectsMalformedLines) {
+  write_file("a|b\nint|int\n1|x\n");
+  EXPECT_THROW(load_table(_file_name, 0), std::exception);
+  write_file("a|b\nint|int\n1\n");
+  EXPECT_THROW(load_table(_file_name, 0), std::exception);
+  write_file("a|b\nint|int\n1|2|3\n");
+  EXPECT_THROW(load_table(_file_name, 0), std::exception);
+}
+
+}  // namespace opossum
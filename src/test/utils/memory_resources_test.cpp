@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/memory_resources.hpp"
+
+namespace opossum {
+
+class MemoryResourcesTest : public BaseTest {};
+
+TEST_F(MemoryResourcesTest, MapsLargeAllocationsToHugePages) {
+  constexpr auto HUGE_PAGE_SIZE = HugePageMemoryResource::HUGE_PAGE_SIZE;
+  auto memory_resource = HugePageMemoryResource{};
+  auto* const memory = static_cast<char*>(memory_resource.allocate(HUGE_PAGE_SIZE + 1, alignof(uint64_t)));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % HUGE_PAGE_SIZE, 0u);
+  EXPECT_EQ(memory_resource.mapped_size(), 2 * HUGE_PAGE_SIZE);
+
+  std::memset(memory, 1, HUGE_PAGE_SIZE + 1);
+  EXPECT_EQ(memory[HUGE_PAGE_SIZE], 1);
+
+  memory_resource.deallocate(memory, HUGE_PAGE_SIZE + 1, alignof(uint64_t));
+  EXPECT_EQ(memory_resource.mapped_size(), 0u);
+}
+
+TEST_F(MemoryResourcesTest, ForwardsSmallAllocations) {
+  auto upstream = std::pmr::monotonic_buffer_resource{};
+  auto memory_resource = HugePageMemoryResource{&upstream, 1024};
+  auto* const memory = memory_resource.allocate(1000);
+  EXPECT_EQ(memory_resource.mapped_size(), 0u);
+  memory_resource.deallocate(memory, 1000);
+}
+
+TEST_F(MemoryResourcesTest, TableWithHugePages) {
+  auto table = Table{0, huge_page_memory_resource()};
+  table.add_column("a", "int");
+  table.append_columns({std::make_shared<ValueSegment<int>>(pmr_vector<int>(HugePageMemoryResource::HUGE_PAGE_SIZE))});
+
+  const auto segment =
+      std::dynamic_pointer_cast<ValueSegment<int>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_EQ(segment->values().get_allocator().resource(), huge_page_memory_resource());
+  EXPECT_GT(static_cast<HugePageMemoryResource*>(huge_page_memory_resource())->mapped_size(), 0u);
+}
+
+}  // namespace opossum
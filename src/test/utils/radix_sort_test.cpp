@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/radix_sort.hpp"
+
+namespace opossum {
+
+class RadixSortTest : public BaseTest {};
+
+TEST_F(RadixSortTest, SortsSignedKeys) {
+  auto entries = std::vector<std::pair<int64_t, uint32_t>>{};
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{};
+  for (auto index = uint32_t{0}; index < 1000; ++index) entries.emplace_back(distribution(generator), index);
+  entries.emplace_back(std::numeric_limits<int64_t>::min(), 1000);
+  entries.emplace_back(-1, 1001);
+  entries.emplace_back(0, 1002);
+
+  auto expected = entries;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  radix_sort_by_key(entries);
+  EXPECT_EQ(entries, expected);
+}
+
+TEST_F(RadixSortTest, IsStable) {
+  auto entries = std::vector<std::pair<int32_t, char>>{{3, 'a'}, {-2, 'b'}, {3, 'c'}, {1, 'd'}, {-2, 'e'}};
+  radix_sort_by_key(entries);
+  EXPECT_EQ(entries, (std::vector<std::pair<int32_t, char>>{{-2, 'b'}, {-2, 'e'}, {1, 'd'}, {3, 'a'}, {3, 'c'}}));
+}
+
+}  // namespace opossum
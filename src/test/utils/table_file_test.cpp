@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/mapped_attribute_vector.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/table_file.hpp"
+
+namespace opossum {
+
+class TableFileTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    for (auto i = 0; i < 1000; ++i) _table->append({i % 300, "value_" + std::to_string(i % 7), i * 0.5});
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = (std::filesystem::temp_directory_path() / "opossum_table_file_test.bin").string();
+};
+
+TEST_F(TableFileTest, SaveAndMapTable) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  auto& chunk = _table->get_chunk(ChunkID{2});
+  chunk.replace_segments({encode_segment(EncodingType::FrameOfReference, "int", chunk.get_segment(ColumnID{0})),
+                          encode_segment(EncodingType::FrontCodedDictionary, "string", chunk.get_segment(ColumnID{1})),
+                          chunk.get_segment(ColumnID{2})},
+                         {});
+  auto& bit_packed_chunk = _table->get_chunk(ChunkID{3});
+  bit_packed_chunk.replace_segments(
+      {encode_segment({EncodingType::Dictionary, AttributeVectorType::BitPacked}, "int",
+                      bit_packed_chunk.get_segment(ColumnID{0})),
+       encode_segment({EncodingType::Dictionary, AttributeVectorType::SimdBp128}, "string",
+                      bit_packed_chunk.get_segment(ColumnID{1})),
+       encode_segment(EncodingType::RunLength, "double", bit_packed_chunk.get_segment(ColumnID{2}))},
+      {});
+  save_table(*_table, _file_name);
+
+  const auto mapped_table = mmap_table(_file_name);
+  EXPECT_EQ(mapped_table->column_names(), _table->column_names());
+  EXPECT_EQ(mapped_table->column_type(ColumnID{1}), "string");
+  EXPECT_EQ(mapped_table->target_chunk_size(), 3u);
+  ASSERT_EQ(mapped_table->chunk_count(), _table->chunk_count());
+  EXPECT_EQ(mapped_table->row_count(), 1000u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+      const auto& segment = *_table->get_chunk(chunk_id).get_segment(column_id);
+      const auto& mapped_segment = *mapped_table->get_chunk(chunk_id).get_segment(column_id);
+      // the segments keep their encoding and size
+      ASSERT_EQ(typeid(mapped_segment), typeid(segment));
+      EXPECT_EQ(mapped_segment.estimate_memory_usage(), segment.estimate_memory_usage());
+      ASSERT_EQ(mapped_segment.size(), segment.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        EXPECT_EQ(mapped_segment[chunk_offset], segment[chunk_offset]);
+      }
+    }
+  }
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      mapped_table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const MappedAttributeVector<uint8_t>>(dictionary_segment->attribute_vector()));
+  const auto bit_packed_segment = std::dynamic_pointer_cast<DictionarySegment<int>>(
+      mapped_table->get_chunk(ChunkID{3}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(bit_packed_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(bit_packed_segment->attribute_vector()));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(mapped_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "value_3");
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 143u);
+
+  // the chunks are backed by the file
+  EXPECT_THROW(mapped_table->get_chunk(ChunkID{333}).append({1, "a", 1.0}), std::exception);
+}
+
+TEST_F(TableFileTest, MappedTableOutlivesOtherReferences) {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  save_table(*_table, _file_name);
+  {
+    const auto mapped_table = mmap_table(_file_name);
+    mapped_table->compress_chunk(ChunkID{5});
+    save_table(*mapped_table, _file_name + ".copy");
+  }
+  const auto copied_table = mmap_table(_file_name + ".copy");
+  segment = copied_table->get_chunk(ChunkID{5}).get_segment(ColumnID{1});
+  std::remove((_file_name + ".copy").c_str());
+  EXPECT_EQ((*segment)[2], AllTypeVariant{"value_3"});
+}
+
+TEST_F(TableFileTest, SavesOnlyAppendedRowsOfOpenMvccChunks) {
+  auto table = Table{10, storage_memory_resource(), UseMvcc::Yes};
+  table.add_column("a", "int");
+  for (auto i = 0; i < 3; ++i) table.append({i});
+  save_table(table, _file_name);
+
+  const auto mapped_table = mmap_table(_file_name);
+  EXPECT_EQ(mapped_table->row_count(), 3u);
+  EXPECT_EQ(mapped_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})->size(), 3u);
+}
+
+TEST_F(TableFileTest, RejectsInvalidFiles) {
+  EXPECT_THROW(mmap_table(_file_name), std::exception);
+  {
+    auto stream = std::ofstream{_file_name};
+    stream << "a|b\nint|int\n1|2\n";
+  }
+  EXPECT_THROW(mmap_table(_file_name), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/worker_pool.hpp"
+
+namespace opossum {
+
+class WorkerPoolTest : public BaseTest {};
+
+TEST_F(WorkerPoolTest, ExecutesAllJobs) {
+  auto counter = std::atomic<int>{0};
+  auto futures = std::vector<std::future<void>>{};
+  {
+    auto worker_pool = WorkerPool{4};
+    EXPECT_EQ(worker_pool.thread_count(), 4u);
+    for (auto i = 0; i < 100; ++i) futures.push_back(worker_pool.schedule([&] { ++counter; }));
+    futures.front().get();
+  }
+  // the destructor finishes all scheduled jobs
+  EXPECT_EQ(counter, 100);
+}
+
+TEST_F(WorkerPoolTest, RethrowsExceptions) {
+  auto worker_pool = WorkerPool{1};
+  auto future = worker_pool.schedule([] { throw std::logic_error("failed"); });
+  EXPECT_THROW(future.get(), std::logic_error);
+}
+
+}  // namespace opossum